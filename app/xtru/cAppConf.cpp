@@ -74,6 +74,18 @@ cAppConf::cAppConf(ps::lib::cConfigures& conf)
             ->default_value(1000)
                 ->value_name("N")
          , "N is a positive integer. Set a number of array size.")
+    ("fetch_pipeline_depth"
+        , po::value<int32_t>(&fetch_pipeline_depth_)
+            ->default_value(2)
+                ->value_name("N")
+         , "N is a positive integer. Set a number of buffer sets rotated while fetching."
+           " If N is 2 or more, the next bulk is fetched while the previous one is converted.")
+    ("write_queue_depth"
+        , po::value<int32_t>(&write_queue_depth_)
+            ->default_value(8)
+                ->value_name("N")
+         , "N is a positive integer. Set a number of converted bulks which can wait"
+           " for being written by the writer thread of each data file.")
     ("userid,u"
         , po::value<std::string>(&userid_)
             ->default_value("SYSTEM/MANAGER")
@@ -116,13 +128,19 @@ cAppConf::cAppConf(ps::lib::cConfigures& conf)
          , "")
     ("minimum_free_size"
          , po::value<std::string>()
-         , "")
+            ->default_value("0")
+                ->value_name("[0-9]+[.kMGTP]{0,1}")
+         , "Size to be left free in each directory of dfile_alt_dirs. A data file is not placed into the directory below it.")
     ("auxiliary_dest"
          , po::value<std::string>()
          , "")
     ("dfile_alt_dirs"
          , po::value<std::string>()
-         , "")
+            ->default_value("")
+                ->value_name("dir[,dir...]")
+         , "Directories among which each data file is placed by the free space and the throughput."
+           " The macro {A} of stream_locator is expanded to the one chosen, e.g. \"file://{A}/{C}.{X}\"."
+           " A relative one is under output.")
     ("stdout"
          , po::value<std::string>()
          , "")
@@ -131,6 +149,40 @@ cAppConf::cAppConf(ps::lib::cConfigures& conf)
             ->default_value("file://{O}/{C}.{X}")
                 ->value_name("locator")
          , "")
+    ("preallocate"
+         , po::value<bool>()
+            ->default_value(false)
+                ->value_name("boolean")
+         , "[true|yes|on|1] true preallocates each data file of the file scheme by the size estimated from its segment,"
+           " and trims the rest when it is closed.")
+    ("writeback_window"
+         , po::value<std::string>()
+            ->default_value("0")
+                ->value_name("[0-9]+[.kMGTP]{0,1}")
+         , "Each time this size is written into a file of the file scheme, its writeback is started,"
+           " and the previous window is waited for and dropped from the page cache. 0 leaves it to the kernel.")
+    ("pipe_size"
+         , po::value<std::string>()
+            ->default_value("1M")
+                ->value_name("[0-9]+[.kMGTP]{0,1}")
+         , "Capacity of the pipe of the ipc_pipe and named_pipe schemes, which is also the size of a write."
+           " Beyond /proc/sys/fs/pipe-max-size, it needs the privilege. 0 keeps the default of the system.")
+    ("compress_level"
+         , po::value<int32_t>(&compress_level_)
+            ->default_value(0)
+                ->value_name("N")
+         , "Compression level of the gzip, zstd and lz4 schemes of stream_locator."
+           " 0 means the default level of each codec.")
+    ("compress_frame_size"
+         , po::value<std::string>()
+            ->default_value("4M")
+                ->value_name("[1-9][0-9]*[.kMGTP]{0,1}")
+         , "Size of the uncompressed data of a frame, which is compressed independently of the others.")
+    ("compress_threads"
+         , po::value<int32_t>(&compress_threads_)
+            ->default_value(2)
+                ->value_name("N")
+         , "N is a positive integer. Number of threads which compress the frames of all data files.")
     ("queryfix"
          , po::value<std::string>(&queryfix_)
             ->default_value("qryfix")
@@ -185,7 +237,11 @@ cAppConf::cAppConf(ps::lib::cConfigures& conf)
          , "")
     ("filesize"
          , po::value<std::string>()
-         , "")
+            ->default_value("0")
+                ->value_name("[1-9][0-9]*[.kMGTP]{0,1}")
+         , "Rolls a data file over to the next piece at a row boundary when it reaches the size."
+           " The pieces are named by the macro {N} of stream_locator, or get \"_NNN\" before"
+           " the extension. This will be disabled by zero.")
     ("filetable"
          , po::value<std::string>(&filetable_)
             ->default_value("table.dat")
@@ -267,8 +323,11 @@ cAppConf::cAppConf(ps::lib::cConfigures& conf)
          , po::value<std::string>()
          , "")
     ("consistent"
-         , po::value<std::string>()
-         , "")
+         , po::value<bool>()
+            ->default_value(false)
+                ->value_name("boolean")
+         , "[true|yes|on|1] Captures one SCN at start and unloads all tables AS OF that SCN,"
+           " so that a parallel unload is point-in-time consistent. fbqscn and fbqtime precede it.")
     ("extnameblob"
          , po::value<std::string>(&extnameblob_)
             ->default_value("blo")
@@ -309,7 +368,30 @@ cAppConf::cAppConf(ps::lib::cConfigures& conf)
          , "")
     ("rerunpoint"
          , po::value<std::string>()
-         , "")
+            ->default_value("")
+                ->value_name("file")
+         , "Name of the run manifest, which records the state of each unload task as it finishes."
+           " A relative name is placed in the output directory. Empty disables it.")
+    ("restart"
+         , po::value<bool>()
+            ->default_value(false)
+                ->value_name("boolean")
+         , "[true|yes|on|1] Reads the manifest given by rerunpoint, skips the tasks completed"
+           " by the previous run, and deletes and reruns the partial ones.")
+    ("incremental"
+         , po::value<bool>()
+            ->default_value(false)
+                ->value_name("boolean")
+         , "[true|yes|on|1] Unloads only the rows whose ORA_ROWSCN is greater than the SCN"
+           " recorded by the manifest given by rerunpoint for each table or chunk."
+           " A table or chunk which is not recorded yet is unloaded in full."
+           " The data files of a delta are named by the macro {S} of stream_locator, or get"
+           " \"_scnBASE-NEW\" before the extension. Their control files load with APPEND"
+           " instead of TRUNCATE, so the rows updated must be merged by the user."
+           " ORA_ROWSCN is tracked per block unless the table was created with ROWDEPENDENCIES,"
+           " so that a delta may include unchanged rows. Because ORA_ROWSCN is not supported by"
+           " a flashback query, the current rows are read without AS OF SCN even if consistent"
+           " or fbqscn is given; the SCN taken before the unload is recorded as the next baseline.")
     ("getexttbl"
          , po::value<std::string>()
          , "")
@@ -317,11 +399,16 @@ cAppConf::cAppConf(ps::lib::cConfigures& conf)
          , po::value<std::string>()
          , "")
     ("fbqscn"
-         , po::value<int32_t>()
-         , "")
+         , po::value<int64_t>(&fbqscn_)
+            ->default_value(0)
+                ->value_name("SCN")
+         , "Unloads all tables AS OF the SCN. 0 means that it is not specified.")
     ("fbqtime"
          , po::value<std::string>()
-         , "")
+            ->default_value("")
+                ->value_name("YYYY-MM-DD HH24:MI:SS")
+         , "Unloads all tables AS OF the SCN which corresponds to the time."
+           " Empty means that it is not specified.")
     ("printcolid"
          , po::value<bool>()
             ->default_value(false)
@@ -341,11 +428,15 @@ cAppConf::cAppConf(ps::lib::cConfigures& conf)
          , po::value<std::string>()
          , "")
     ("io_overlap_scale"
-         , po::value<int32_t>()
-         , "")
+         , po::value<int32_t>(&io_overlap_scale_)
+            ->default_value(4)
+                ->value_name("N")
+         , "N is a positive integer. Number of writes in flight per file of the direct scheme of stream_locator.")
     ("overlap_buffer_length"
          , po::value<std::string>()
-         , "")
+            ->default_value("1M")
+                ->value_name("[1-9][0-9]*[.kMGTP]{0,1}")
+         , "Size of a buffer written with O_DIRECT by the direct scheme. It is rounded up to 4k.")
     ("db_file_multiblock_read_count"
          , po::value<int32_t>()
          , "")
@@ -365,6 +456,33 @@ cAppConf::cAppConf(ps::lib::cConfigures& conf)
             ->default_value("0M")
                 ->value_name("[1-9][0-9]*[.kMGTP]{0,1}")
          , "Specify a minimum size of the segment that be splitted by rowid range. This will be disabled by zero.")
+    ("rowid_split_dynamic"
+         , po::value<bool>()
+            ->default_value(false)
+                ->value_name("boolean")
+         , "[true|yes|on|1] A table splitted by rowid range is unloaded into one data file by "
+           "rowid_split_num_parts statements, which take small block ranges from a shared queue "
+           "one after another. The ranges get smaller as the queue drains.")
+    ("rowid_split_min_blocks"
+         , po::value<int32_t>(&rowid_split_min_blocks_)
+            ->default_value(128)
+                ->value_name("N")
+         , "N is a positive integer. Set a minimum number of blocks of a range taken at a time"
+           " when rowid_split_dynamic is enabled.")
+    ("query_split_num_parts"
+         , po::value<int32_t>(&query_split_num_parts_)
+            ->default_value(0)
+                ->value_name("N")
+         , "N is zero or a positive integer. N greater than 1 rewrites a query of the query feature"
+           " over one driving table into N statements by ORA_HASH(ROWID, N-1), which are unloaded"
+           " into one data file in parallel. 0 disables it.")
+    ("key_split_sample_percent"
+         , po::value<int32_t>(&key_split_sample_percent_)
+            ->default_value(1)
+                ->value_name("N")
+         , "N is an integer from 1 to 100. Set a percentage of the blocks sampled to find the ranges"
+           " of the leading primary key column of an index-organized table which is splitted like"
+           " rowid_split_min_size and rowid_split_num_parts. 100 reads all rows.")
     ("file_mapping"
          , po::value<int32_t>()
          , "")
@@ -451,6 +569,24 @@ cAppConf::cAppConf(ps::lib::cConfigures& conf)
                 ->value_name("mask")
          , "mask is a form that applies when expressing a TIMESTAMP WITH TIMEZONE type "
            "value as a string.")
+    ("native_datetime"
+         , po::value<bool>()
+            ->default_value(false)
+                ->value_name("boolean")
+         , "[true|yes|on|1] DATE and TIMESTAMP values are fetched in binary and formatted "
+           "with date_mask, timestamp_mask or timestamp_tz_mask on the client.")
+    ("lob_streaming"
+         , po::value<bool>()
+            ->default_value(false)
+                ->value_name("boolean")
+         , "[true|yes|on|1] CLOB and BLOB values are read through their locators piece by piece "
+           "and streamed to the data file, instead of being held in memory as a whole.")
+    ("lob_piece_size"
+         , po::value<int32_t>(&lob_piece_size_)
+            ->default_value(1048576)
+                ->value_name("N")
+         , "N is a positive integer. Set a number of bytes read from a CLOB or BLOB at a time"
+           " when lob_streaming is enabled.")
     ("events_10046"
          , po::value<std::string>()
          , "")
@@ -491,6 +627,15 @@ cAppConf::cAppConf(ps::lib::cConfigures& conf)
     ("fpnumfmt"
          , po::value<std::string>()
          , "")
+    ("number_decoder"
+         , po::value<std::string>(&number_decoder_)
+            ->default_value("verify")
+                ->value_name("mode")
+         , "mode is one of oci, native or verify. It selects how NUMBER values of high precision"
+           " are converted to strings. oci calls OCINumberToText for every value, native decodes"
+           " them in process, and verify does the same as native but compares sampled values"
+           " with OCINumberToText. A format model of fpnumfmt with G or D, which depend on"
+           " NLS_NUMERIC_CHARACTERS of the session, is always converted by OCINumberToText.")
     ("taf_delay_time"
          , po::value<int32_t>()
             ->default_value(60)
@@ -560,6 +705,19 @@ int32_t cAppConf::iValidate(
     iErrors += PS_UTL_CCONFIGURES_VALIDATE(os, vm, "parallelism", parallelism_ > 0);
     iErrors += PS_UTL_CCONFIGURES_VALIDATE(os, vm, "userid", !userid_.empty());
     iErrors += PS_UTL_CCONFIGURES_VALIDATE(os, vm, "bulk_size", bulk_size_ > 0);
+    iErrors += PS_UTL_CCONFIGURES_VALIDATE(os, vm, "fetch_pipeline_depth", fetch_pipeline_depth_ > 0);
+    iErrors += PS_UTL_CCONFIGURES_VALIDATE(os, vm, "write_queue_depth", write_queue_depth_ > 0);
+    iErrors += PS_UTL_CCONFIGURES_VALIDATE(os, vm, "lob_piece_size", lob_piece_size_ > 0);
+    iErrors += PS_UTL_CCONFIGURES_VALIDATE(os, vm, "rowid_split_min_blocks", rowid_split_min_blocks_ > 0);
+    iErrors += PS_UTL_CCONFIGURES_VALIDATE(os, vm, "query_split_num_parts", query_split_num_parts_ >= 0);
+    iErrors += PS_UTL_CCONFIGURES_VALIDATE(os, vm, "fbqscn", fbqscn_ >= 0);
+    iErrors += PS_UTL_CCONFIGURES_VALIDATE(os, vm, "compress_level", compress_level_ >= 0);
+    iErrors += PS_UTL_CCONFIGURES_VALIDATE(os, vm, "compress_threads", compress_threads_ > 0);
+    iErrors += PS_UTL_CCONFIGURES_VALIDATE(os, vm, "io_overlap_scale", io_overlap_scale_ > 0);
+    iErrors += PS_UTL_CCONFIGURES_VALIDATE(os, vm, "key_split_sample_percent"
+        , key_split_sample_percent_ > 0 && key_split_sample_percent_ <= 100);
+    iErrors += PS_UTL_CCONFIGURES_VALIDATE(os, vm, "number_decoder"
+        , number_decoder_ == "oci" || number_decoder_ == "native" || number_decoder_ == "verify");
     iErrors += PS_UTL_CCONFIGURES_VALIDATE(os, vm, "queryfix", !queryfix_.empty());
     iErrors += PS_UTL_CCONFIGURES_VALIDATE(os, vm, "queryvar", !queryvar_.empty());
     iErrors += PS_UTL_CCONFIGURES_VALIDATE(os, vm, "queryfilename", !queryfilename_.empty());
@@ -41,6 +41,10 @@ private:
     std::string userid_;
     std::string src_user_;
     int32_t bulk_size_;
+    int32_t fetch_pipeline_depth_;
+    int32_t write_queue_depth_;
+    std::string number_decoder_;
+    int32_t lob_piece_size_;
     std::string dfile_alt_dirs_;
     std::string queryfix_;
     std::string queryvar_;
@@ -67,6 +71,13 @@ private:
     int32_t numdays_audit_;
     int32_t longtransit_;
     int32_t rowid_split_num_parts;
+    int32_t rowid_split_min_blocks_;
+    int32_t key_split_sample_percent_;
+    int32_t query_split_num_parts_;
+    int64_t fbqscn_;
+    int32_t compress_level_;
+    int32_t compress_threads_;
+    int32_t io_overlap_scale_;
     int32_t reclength_;
     std::string sStatement_;
 public:
@@ -158,7 +158,16 @@ void cCopyDd::vCreateRepo()
     vInitializeRepo(
         "ROWID_RANGES"
         , [this](){return oDb_->iExecSql(ps::app::xtru::copydd::cRowidRanges::szCreStmt);}
-        , [this](){return oDb_->iExecSql(ps::app::xtru::copydd::cRowidRanges::szDelStmt);}
+        // The columns may differ from the older version, the table is recreated every time.
+        , [this](){return oDb_->iExecSql({
+                ps::app::xtru::copydd::cRowidRanges::szDrpStmt
+                , ps::app::xtru::copydd::cRowidRanges::szCreStmt
+            });}
+    );
+    vInitializeRepo(
+        "KEY_RANGES"
+        , [this](){return oDb_->iExecSql(ps::app::xtru::copydd::cKeyRanges::szCreStmt);}
+        , [this](){return oDb_->iExecSql(ps::app::xtru::copydd::cKeyRanges::szDelStmt);}
     );
     vInitializeRepo(
         "TARGET_TABLES"
@@ -327,6 +336,9 @@ void cCopyDd::vRefresGetDataRepo(const ps::lib::str_vct& oOwners)
             ) << std::endl;
         }
     }
+    // table: KEY_RANGES
+    // The target tables have to be settled to sample only the index-organized tables unloaded.
+    cKeyRanges::vRefresh(*oSvc_, *oDb_);
     // table: EFFECTIVE_CONS
     {
         cReposRefresher<cEffectiveCons> oRCons(*oDb_, cEffectiveCons::B);
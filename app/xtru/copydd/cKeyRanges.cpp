@@ -0,0 +1,299 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <pslib.h>
+#include <xtru.h>
+
+#define DATA_TYPE_LEN                     (106+1)
+
+namespace ps
+{
+
+namespace app
+{
+
+namespace xtru
+{
+
+namespace copydd
+{
+
+struct cKeyRanges::tAttributes
+{
+    char szOwner[OBJECT_NAME_LEN];             // NOT NULL VARCHAR2(30)
+    char szTableName[OBJECT_NAME_LEN];         // NOT NULL VARCHAR2(30)
+    char szColumnName[COLUMN_NAME_LEN];        // NOT NULL VARCHAR2(30)
+    int32_t iRangeNo;                          // n = 1,2,3, ...
+    char szHiVal[KEY_LITERAL_LEN];             // NOT NULL upper bound of the range n, as a literal.
+};
+
+const char cKeyRanges::szCreStmt[] = {
+"CREATE TABLE KEY_RANGES\n"
+"( OWNER                          TEXT NOT NULL\n"
+", TABLE_NAME                     TEXT NOT NULL\n"
+", COLUMN_NAME                    TEXT NOT NULL\n"
+", RN                             INT NOT NULL\n"
+", HIVAL                          TEXT NOT NULL\n"
+", CONSTRAINT PK_KEY_RANGES PRIMARY KEY\n"
+    "( OWNER\n"
+    ", TABLE_NAME\n"
+    ", RN\n"
+    ")\n"
+")"
+};
+
+const char cKeyRanges::szDelStmt[] = {
+"DELETE FROM KEY_RANGES"
+};
+
+/*
+ * The rows sampled are divided into :NUM_RANGES groups by NTILE,
+ * and the largest key of each group but the last one becomes a boundary.
+ * The placeholders are replaced with:
+ * owner, table, column, literal of k, sort key of k (twice), column, owner, table,
+ * sample clause and sort key of k.
+ */
+const char cKeyRanges::szInStmt_[] = {
+"select '%s', '%s', '%s', rownum, hival "
+"from ( "
+    "select %s hival "
+    "from ( "
+        "select distinct k "
+        "from ( "
+            "select nt, max(k) keep (dense_rank last order by %s) k "
+            "from ( "
+                "select k, ntile(:NUM_RANGES) over (order by %s) nt "
+                "from ( "
+                    "select \"%s\" k from \"%s\".\"%s\" %s "
+                ") "
+            ") "
+            "group by nt "
+        ") "
+        "where nt < :NUM_RANGES "
+    ") "
+    "order by %s "
+") "
+};
+
+const char cKeyRanges::szOutStmt_[] = {
+"INSERT INTO KEY_RANGES "
+"( OWNER "
+", TABLE_NAME "
+", COLUMN_NAME "
+", RN "
+", HIVAL "
+") VALUES (?,?,?,?,?)"
+};
+
+const uint32_t cKeyRanges::iBulkSize_ = 100;
+
+const cKeyRanges::tKeyType* cKeyRanges::oGetKeyType(const std::string& sDataType)
+{
+    static const tKeyType oNumber = {
+        "to_char(k, 'TM9', 'NLS_NUMERIC_CHARACTERS=''.,''')"
+        , "k"
+    };
+    // The ordering of NLS_SORT may differ from the comparison of the predicates.
+    static const tKeyType oString = {
+        "'''' || replace(k, '''', '''''') || ''''"
+        , "nlssort(k, 'NLS_SORT=BINARY')"
+    };
+    static const tKeyType oDate = {
+        "'TO_DATE(''' || to_char(k, 'SYYYYMMDDHH24MISS') || ''', ''SYYYYMMDDHH24MISS'')'"
+        , "k"
+    };
+    static const tKeyType oTimestamp = {
+        "'TO_TIMESTAMP(''' || to_char(k, 'SYYYYMMDDHH24MISSFF9') || ''', ''SYYYYMMDDHH24MISSFF9'')'"
+        , "k"
+    };
+    if (sDataType == "NUMBER" || sDataType == "FLOAT")
+    {
+        return &oNumber;
+    }
+    else if (sDataType == "VARCHAR2" || sDataType == "CHAR")
+    {
+        return &oString;
+    }
+    else if (sDataType == "DATE")
+    {
+        return &oDate;
+    }
+    // Such as TIMESTAMP(6), but not WITH (LOCAL) TIME ZONE.
+    else if (sDataType.compare(0, 10, "TIMESTAMP(") == 0 && sDataType.back() == ')')
+    {
+        return &oTimestamp;
+    }
+    return nullptr;
+}
+
+cKeyRanges::cKeyRanges(
+    ps::lib::sql::occi::cSvc& oSvc
+    , ps::lib::sql::lite3::cSqliteDb& oDb
+    , const std::string& sOwner
+    , const std::string& sTable
+    , const std::string& sColumn
+    , const tKeyType& oKeyType
+)
+    : cTransporter(oSvc, oDb, iBulkSize_, szInStmt_, "KEY_RANGES", &oBind_, szOutStmt_)
+    , oDefine_(oGetDefine())
+    , iSkip_(sizeof(tAttributes))
+    , rTable_(new tAttributes[iBulkSize_])
+    , conf_(ps::lib::cConfigures::get_const_instance())
+    , iNumRangeParts_(conf_.as<int32_t>("rowid_split_num_parts"))
+{
+    const auto iPercent = conf_.as<int32_t>("key_split_sample_percent");
+    const auto sSample = iPercent < 100 ? (boost::format("sample block (%d)") % iPercent).str() : std::string();
+    // Replacing "%s" in the SQL with string values.
+    this->vConvPlaceHolder({
+        sOwner, sTable, sColumn
+        , oKeyType.szLiteral
+        , oKeyType.szSortKey
+        , oKeyType.szSortKey
+        , sColumn
+        , sOwner, sTable, sSample
+        , oKeyType.szSortKey
+    });
+    // input data
+    oBind_.vAddItem(":NUM_RANGES", &iNumRangeParts_);
+    // Inbounding data from Oracle.
+    oDefine_.vAddItem(rTable_->szOwner, SQLT_STR, NULL, NULL, NULL, iSkip_);
+    oDefine_.vAddItem(rTable_->szTableName, SQLT_STR, NULL, NULL, NULL, iSkip_);
+    oDefine_.vAddItem(rTable_->szColumnName, SQLT_STR, NULL, NULL, NULL, iSkip_);
+    oDefine_.vAddItem(rTable_->iRangeNo, SQLT_INT, NULL, NULL, NULL, iSkip_);
+    oDefine_.vAddItem(rTable_->szHiVal, SQLT_STR, NULL, NULL, NULL, iSkip_);
+    // Adding column attributes to SQLite3.
+    oOBind_.vAddItem(rTable_->szOwner, tLite3Type::STR, NULL, iSkip_, iSkip_);
+    oOBind_.vAddItem(rTable_->szTableName, tLite3Type::STR, NULL, iSkip_, iSkip_);
+    oOBind_.vAddItem(rTable_->szColumnName, tLite3Type::STR, NULL, iSkip_, iSkip_);
+    oOBind_.vAddItem(rTable_->iRangeNo, tLite3Type::INT32, NULL, iSkip_, iSkip_);
+    oOBind_.vAddItem(rTable_->szHiVal, tLite3Type::STR, NULL, iSkip_, iSkip_);
+}
+
+cKeyRanges::~cKeyRanges()
+{
+    delete [] rTable_;
+}
+
+void cKeyRanges::vRefresh(
+    ps::lib::sql::occi::cSvc& oSvc
+    , ps::lib::sql::lite3::cSqliteDb& oDb
+){
+    auto& trc = ps::lib::cTracer::get_mutable_instance();
+    const auto& conf = ps::lib::cConfigures::get_const_instance();
+    auto iNumBytes = ps::lib::iIntStrToBinInt<int64_t>(conf.as<std::string>("rowid_split_min_size"));
+    if (iNumBytes <= 0LL)
+    {
+        return; // Disabled.
+    }
+    static const char sStmt[] = {
+    "SELECT T0.OWNER "
+    ", T0.TABLE_NAME "
+    ", C2.COLUMN_NAME "
+    ", C3.DATA_TYPE "
+    "FROM TARGET_TABLES T0 "
+    ", ALL_TABLES T1 "
+    ", ALL_CONSTRAINTS C1 "
+    ", ALL_CONS_COLUMNS C2 "
+    ", ALL_TAB_COLUMNS C3 "
+    "WHERE T0.IOT_TYPE = 'IOT' "
+    "AND T1.OWNER = T0.OWNER "
+    "AND T1.TABLE_NAME = T0.TABLE_NAME "
+    "AND T1.PARTITIONED = 'NO' "
+    "AND T1.NUM_MBYTES >= ? "
+    "AND C1.OWNER = T0.OWNER "
+    "AND C1.TABLE_NAME = T0.TABLE_NAME "
+    "AND C1.CONSTRAINT_TYPE = 'P' "
+    "AND C2.OWNER = C1.OWNER "
+    "AND C2.CONSTRAINT_NAME = C1.CONSTRAINT_NAME "
+    "AND C2.POSITION = 1 "
+    "AND C3.OWNER = C2.OWNER "
+    "AND C3.TABLE_NAME = C2.TABLE_NAME "
+    "AND C3.COLUMN_NAME = C2.COLUMN_NAME "
+    };
+    struct tCandidate
+    {
+        char szOwner[OBJECT_NAME_LEN];
+        char szTableName[OBJECT_NAME_LEN];
+        char szColumnName[COLUMN_NAME_LEN];
+        char szDataType[DATA_TYPE_LEN];
+    } rRowBuf;
+    ::memset(&rRowBuf, 0, sizeof(rRowBuf));
+    const size_t iSkip = sizeof(rRowBuf);
+    auto iNumMBytes = static_cast<int32_t>(iNumBytes >> 20);  // Convert from bytes -> Mbytes
+    auto iNumMBytesInd = ps::lib::sql::ind_t::VAL_IS_NOTNULL;
+    std::vector<tCandidate> oCandidates;
+    {
+        ps::lib::sql::lite3::cSqliteStmt oStmt(oDb, sStmt);
+        ASSERT_OR_RAISE_FNC(oStmt.iParse() == SQLITE_OK, std::runtime_error, ps::lib::sql::lite3::cCheckErr(oDb));
+        ps::lib::sql::lite3::cDefine& oDefine(oStmt.oGetDefine());
+        using ps::lib::sql::lite3::cAttr;
+        oDefine.vAddItem(rRowBuf.szOwner, cAttr::STR, NULL, iSkip, iSkip);
+        oDefine.vAddItem(rRowBuf.szTableName, cAttr::STR, NULL, iSkip, iSkip);
+        oDefine.vAddItem(rRowBuf.szColumnName, cAttr::STR, NULL, iSkip, iSkip);
+        oDefine.vAddItem(rRowBuf.szDataType, cAttr::STR, NULL, iSkip, iSkip);
+        ps::lib::sql::lite3::cBind& oBind(oStmt.oGetBind());
+        oBind.vAddItem(iNumMBytes, cAttr::INT32, &iNumMBytesInd, 0, 0);
+        ps::lib::sql::lite3::cDirectiveHolder oDirectiveHolder(
+            [&] { oCandidates.push_back(rRowBuf); }
+            , [&] { trc << std::string("Start to read the index-organized tables to be split by the key.") << std::endl; }
+            , [&] { trc << boost::format("Finished to read and returned %d rows.") % oCandidates.size() << std::endl; }
+            , [&] { trc << std::string("Not found the index-organized tables to be split.") << std::endl; }
+        );
+        ASSERT_OR_RAISE_FNC(oStmt.iFetch(oDirectiveHolder) == SQLITE_DONE
+            , std::runtime_error, ps::lib::sql::lite3::cCheckErr(oDb));
+    }
+    for (const auto& rCandidate: oCandidates)
+    {
+        const auto oKeyType = oGetKeyType(rCandidate.szDataType);
+        if (! oKeyType)
+        {
+            trc << boost::format("\"%s\".\"%s\" is not split because the key \"%s\" is %s.")
+                % rCandidate.szOwner % rCandidate.szTableName
+                % rCandidate.szColumnName % rCandidate.szDataType
+                << std::endl;
+            continue;
+        }
+        std::unique_ptr<ps::lib::sql::cFetchable> t(new cKeyRanges(
+            oSvc, oDb, rCandidate.szOwner, rCandidate.szTableName, rCandidate.szColumnName, *oKeyType
+        ));
+        t->vExecuteAndFetch();
+    }
+}
+
+void cKeyRanges::vPreBulkAction(const uint32_t& iBulkSize)
+{
+    ::memset(rTable_, 0, iSkip_ * iBulkSize);
+}
+
+void cKeyRanges::vPostBulkAction(const uint32_t& iNumIter)
+{
+    ASSERT_OR_RAISE_FNC(iExecute(iNumIter) == SQLITE_DONE, std::runtime_error, ps::lib::sql::lite3::cCheckErr(oGetDb()));
+    vAddOutputBytes(iSkip_ * iNumIter);
+    vAddOutputRows(iNumIter);
+}
+
+} // ps::app::xtru::copydd
+
+} // ps::app::xtru
+
+} // ps::app
+
+} // ps
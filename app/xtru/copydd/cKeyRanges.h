@@ -0,0 +1,109 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+namespace ps
+{
+
+namespace app
+{
+
+namespace xtru
+{
+
+namespace copydd
+{
+
+/**
+ * @class cKeyRanges
+ * @brief
+ * - Index-organized tables can not be split by rowid range.
+ *   Instead, the leading column of the primary key of a large IOT
+ *   is split into rowid_split_num_parts ranges by its quantiles.
+ * - The quantiles are found by NTILE over the rows sampled by SAMPLE BLOCK,
+ *   and the upper bound of each range is stored into KEY_RANGES as a literal.
+ */
+class cKeyRanges
+    : public ps::lib::sql::cTransporter
+{
+private:
+    struct tAttributes;
+    static const char szInStmt_[];  ///< Inbounding from Oracle.
+    static const char szOutStmt_[]; ///< Outbounding to SQLite3.
+    static const uint32_t iBulkSize_;
+    ps::lib::sql::occi::cBind oBind_;
+    ps::lib::sql::occi::cDefine& oDefine_;
+    const size_t iSkip_;
+    tAttributes * rTable_;
+    const ps::lib::cConfigures& conf_;
+    int32_t iNumRangeParts_;
+    /**
+     * @brief
+     *   Expressions of SQL to convert the key column "k" according to its data type.
+     */
+    struct tKeyType
+    {
+        const char* szLiteral;      ///< Makes a literal of the value.
+        const char* szSortKey;      ///< Makes a key of ordering by the binary comparison.
+    };
+    /// @return nullptr if the data type can not be split.
+    static const tKeyType* oGetKeyType(const std::string& sDataType);
+public:
+    static const char szCreStmt[]; ///< Creating newly.
+    static const char szDelStmt[]; ///< Deleting all rows.
+    /**
+     * @param[in] sOwner
+     * @param[in] sTable
+     * @param[in] sColumn
+     *   Leading column of the primary key.
+     * @param[in] oKeyType
+     */
+    cKeyRanges(
+        ps::lib::sql::occi::cSvc& oSvc
+        , ps::lib::sql::lite3::cSqliteDb& oDb
+        , const std::string& sOwner
+        , const std::string& sTable
+        , const std::string& sColumn
+        , const tKeyType& oKeyType
+    );
+    virtual ~cKeyRanges();
+    /**
+     * @brief
+     *   Finds the ranges of each IOT in TARGET_TABLES which is larger than
+     *   rowid_split_min_size. It has to be called after TARGET_TABLES is refreshed.
+     */
+    static void vRefresh(
+        ps::lib::sql::occi::cSvc& oSvc
+        , ps::lib::sql::lite3::cSqliteDb& oDb
+    );
+private:
+    virtual void vPreBulkAction(const uint32_t& iBulkSize);
+    virtual void vPostBulkAction(const uint32_t& iNumIter);
+};
+
+} // ps::app::xtru::copydd
+
+} // ps::app::xtru
+
+} // ps::app
+
+} // ps
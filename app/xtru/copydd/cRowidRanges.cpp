@@ -38,6 +38,8 @@ struct cRowidRanges::tAttributes
 {
     char szOwner[OBJECT_NAME_LEN];             // NOT NULL VARCHAR2(30)
     char szTableName[OBJECT_NAME_LEN];         // NOT NULL VARCHAR2(30)
+    char szPartitionName[OBJECT_NAME_LEN];     // NOT NULL VARCHAR2(30), ' ' if not partitioned.
+    char szSubpartitionName[OBJECT_NAME_LEN];  // NOT NULL VARCHAR2(30), ' ' if not subpartitioned.
     int32_t iRangeNo;                              // n = 1,2,3, ...
     char szRowidBgn[ROWID_STR_LEN];             // NOT NULL VARCHAR2(19)
     char szRowidEnd[ROWID_STR_LEN];             // NOT NULL VARCHAR2(19)
@@ -47,12 +49,16 @@ const char cRowidRanges::szCreStmt[] = {
 "CREATE TABLE ROWID_RANGES\n"
 "( OWNER                          TEXT NOT NULL\n"
 ", SEGMENT_NAME                   TEXT NOT NULL\n"
+", PARTITION_NAME                 TEXT NOT NULL\n"
+", SUBPARTITION_NAME              TEXT NOT NULL\n"
 ", RN                             INT NOT NULL\n"
 ", PREDB                          TEXT NOT NULL\n"
 ", PREDE                          TEXT NOT NULL\n"
 ", CONSTRAINT PK_ROWID_RANGES PRIMARY KEY\n"
     "( OWNER\n"
     ", SEGMENT_NAME\n"
+    ", PARTITION_NAME\n"
+    ", SUBPARTITION_NAME\n"
     ", RN\n"
     ")\n"
 ")"
@@ -62,19 +68,29 @@ const char cRowidRanges::szDelStmt[] = {
 "DELETE FROM ROWID_RANGES"
 };
 
+const char cRowidRanges::szDrpStmt[] = {
+"DROP TABLE ROWID_RANGES"
+};
+
+/*
+ * Each segment of the table, the partition or the subpartition is
+ * split into :NUM_RANGES ranges by its blocks.
+ * PARTITION_NAME of a subpartition is the name of the partition it belongs to,
+ * so that the ranges are picked up for each task of cPartitionedByScheme.
+ */
 const char cRowidRanges::szInStmt_[] = {
-"select c.owner, c.segment_name "
+"select c.owner, c.segment_name, c.ppart, c.spart "
 ", c.rn + 1 as rn "
 ", sys.dbms_rowid.rowid_create(1, d.oid, c.fid1, c.bid1, 0)    predb "
 ", sys.dbms_rowid.rowid_create(1, d.oid, c.fid2, c.bid2, 9999) prede "
 "from ( "
-    "select distinct a.owner, a.segment_name, b.rn "
+    "select distinct a.owner, a.segment_name, a.pname, a.ppart, a.spart, b.rn "
     ", first_value(a.fid) over ( "
-        "partition by a.owner, a.segment_name, b.rn "
+        "partition by a.owner, a.segment_name, a.pname, b.rn "
         "order by a.fid, a.bid rows between unbounded preceding "
                                        "and unbounded following) fid1 "
     ", last_value(a.fid) over ( "
-        "partition by a.owner, a.segment_name, b.rn "
+        "partition by a.owner, a.segment_name, a.pname, b.rn "
         "order by a.fid, a.bid rows between unbounded preceding "
                                        "and unbounded following) fid2 "
     ", first_value( "
@@ -85,7 +101,7 @@ const char cRowidRanges::szInStmt_[] = {
             ", a.bid "
         ") "
     ") over ( "
-        "partition by a.owner, a.segment_name, b.rn "
+        "partition by a.owner, a.segment_name, a.pname, b.rn "
         "order by a.fid, a.bid rows between unbounded preceding "
                                        "and unbounded following) bid1 "
     ", last_value( "
@@ -96,11 +112,11 @@ const char cRowidRanges::szInStmt_[] = {
             ", (a.bid + a.blocks - 1) "
         ") "
     ") over ( "
-        "partition by a.owner, a.segment_name, b.rn "
+        "partition by a.owner, a.segment_name, a.pname, b.rn "
         "order by a.fid, a.bid rows between unbounded preceding "
                                        "and unbounded following) bid2 "
     "from ( "
-        "select owner, segment_name "
+        "select owner, segment_name, pname, ppart, spart "
         ", fid "
         ", bid "
         ", blocks "
@@ -108,19 +124,26 @@ const char cRowidRanges::szInStmt_[] = {
         ", trunc((sum2 - blocks + 1 - 0.1) / chunks1) range1 "
         ", trunc((sum2 - 0.1) / chunks1) range2 "
         "from ( "
-            "select /*+ rule */ owner, segment_name "
-            ", relative_fno fid "
-            ", block_id bid "
-            ", blocks "
-            ", sum(blocks) over () sum1 "
-            ", trunc((sum(blocks) over ( "
-                "partition by owner, segment_name)) / :NUM_RANGES) chunks1 "
-            ", sum(blocks) over ( "
-                "partition by owner, segment_name "
-                "order by relative_fno, block_id) sum2 "
-            "from dba_extents "
-            "where owner in %s "
-            "and partition_name is null "
+            "select /*+ rule */ e.owner, e.segment_name "
+            ", nvl(e.partition_name, ' ') pname "
+            ", nvl(s.partition_name, nvl(e.partition_name, ' ')) ppart "
+            ", nvl2(s.partition_name, e.partition_name, ' ') spart "
+            ", e.relative_fno fid "
+            ", e.block_id bid "
+            ", e.blocks "
+            ", sum(e.blocks) over () sum1 "
+            ", trunc((sum(e.blocks) over ( "
+                "partition by e.owner, e.segment_name, e.partition_name)) / :NUM_RANGES) chunks1 "
+            ", sum(e.blocks) over ( "
+                "partition by e.owner, e.segment_name, e.partition_name "
+                "order by e.relative_fno, e.block_id) sum2 "
+            "from dba_extents e "
+            ", dba_tab_subpartitions s "
+            "where e.owner in %s "
+            "and e.segment_type in ('TABLE', 'TABLE PARTITION', 'TABLE SUBPARTITION') "
+            "and s.table_owner (+) = e.owner "
+            "and s.table_name (+) = e.segment_name "
+            "and s.subpartition_name (+) = e.partition_name "
         ") "
         "where sum1 > :NUM_RANGES "
         "and chunks1 > 0 "
@@ -132,25 +155,28 @@ const char cRowidRanges::szInStmt_[] = {
     "where b.rn between a.range1 and a.range2 "
 ") c "
 ", ( "
-    "select owner, object_name, max(data_object_id) oid "
+    "select owner, object_name, nvl(subobject_name, ' ') pname, max(data_object_id) oid "
     "from dba_objects "
     "where owner in %s "
     "and data_object_id is not null "
-    "and object_type = 'TABLE' "
-    "group by owner, object_name "
+    "and object_type in ('TABLE', 'TABLE PARTITION', 'TABLE SUBPARTITION') "
+    "group by owner, object_name, nvl(subobject_name, ' ') "
 ") d "
 "where c.owner = d.owner "
 "and c.segment_name = d.object_name "
+"and c.pname = d.pname "
 };
 
 const char cRowidRanges::szOutStmt_[] = {
 "INSERT INTO ROWID_RANGES "
 "( OWNER "
 ", SEGMENT_NAME "
+", PARTITION_NAME "
+", SUBPARTITION_NAME "
 ", RN "
 ", PREDB "
 ", PREDE "
-") VALUES (?,?,?,?,?)"
+") VALUES (?,?,?,?,?,?,?)"
 };
 
 const uint32_t cRowidRanges::iBulkSize_ = 1000;
@@ -174,6 +200,7 @@ cRowidRanges::cRowidRanges(
     oMetaData.vAddNamesAndTypes({
         { "SYS.DBA_OBJECTS", oracle::occi::MetaData::PTYPE_UNK }
         , { "SYS.DBA_EXTENTS", oracle::occi::MetaData::PTYPE_UNK }
+        , { "SYS.DBA_TAB_SUBPARTITIONS", oracle::occi::MetaData::PTYPE_UNK }
     });
     iAvailable_ = oMetaData.iGetAvailability() && (iNumBytes > 0LL);
     // Replacing "%s" in the SQL with string values.
@@ -183,12 +210,16 @@ cRowidRanges::cRowidRanges(
     // Inbounding data from Oracle.
     oDefine_.vAddItem(rTable_->szOwner, SQLT_STR, NULL, NULL, NULL, iSkip_);
     oDefine_.vAddItem(rTable_->szTableName, SQLT_STR, NULL, NULL, NULL, iSkip_);
+    oDefine_.vAddItem(rTable_->szPartitionName, SQLT_STR, NULL, NULL, NULL, iSkip_);
+    oDefine_.vAddItem(rTable_->szSubpartitionName, SQLT_STR, NULL, NULL, NULL, iSkip_);
     oDefine_.vAddItem(rTable_->iRangeNo, SQLT_INT, NULL, NULL, NULL, iSkip_);
     oDefine_.vAddItem(rTable_->szRowidBgn, SQLT_STR, NULL, NULL, NULL, iSkip_);
     oDefine_.vAddItem(rTable_->szRowidEnd, SQLT_STR, NULL, NULL, NULL, iSkip_);
     // Adding column attributes to SQLite3.
     oOBind_.vAddItem(rTable_->szOwner, tLite3Type::STR, NULL, iSkip_, iSkip_);
     oOBind_.vAddItem(rTable_->szTableName, tLite3Type::STR, NULL, iSkip_, iSkip_);
+    oOBind_.vAddItem(rTable_->szPartitionName, tLite3Type::STR, NULL, iSkip_, iSkip_);
+    oOBind_.vAddItem(rTable_->szSubpartitionName, tLite3Type::STR, NULL, iSkip_, iSkip_);
     oOBind_.vAddItem(rTable_->iRangeNo, tLite3Type::INT32, NULL, iSkip_, iSkip_);
     oOBind_.vAddItem(rTable_->szRowidBgn, tLite3Type::STR, NULL, iSkip_, iSkip_);
     oOBind_.vAddItem(rTable_->szRowidEnd, tLite3Type::STR, NULL, iSkip_, iSkip_);
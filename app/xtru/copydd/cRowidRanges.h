@@ -51,6 +51,7 @@ private:
 public:
     static const char szCreStmt[]; ///< Creating newly.
     static const char szDelStmt[]; ///< Deleting all rows.
+    static const char szDrpStmt[]; ///< Dropping the table created by the older version.
     cRowidRanges(
         ps::lib::sql::occi::cSvc& oSvc
         , ps::lib::sql::lite3::cSqliteDb& oDb
@@ -272,6 +272,7 @@ ps::app::xtru::cTableList cTargetTables::oRmWhereNumRows(ps::lib::sql::occi::cSv
         ", t1.DATA_FMT "
         ", t1.NUM_LONGS "
         ", t1.NUM_LOBS "
+        ", t2.NUM_MBYTES "
         "FROM TARGET_TABLES t1 "
         ", ALL_TABLES t2 "
         "WHERE t2.OWNER = t1.OWNER "
@@ -287,6 +288,7 @@ ps::app::xtru::cTableList cTargetTables::oRmWhereNumRows(ps::lib::sql::occi::cSv
     oDefine.vAddItem(rRowBuf.iDataFmt, cAttr::INT32, iInd_, iSkip_, iSkip_);
     oDefine.vAddItem(rRowBuf.iNumLongs, cAttr::INT32, iInd_, iSkip_, iSkip_);
     oDefine.vAddItem(rRowBuf.iNumLobs, cAttr::INT32, iInd_, iSkip_, iSkip_);
+    oDefine.vAddItem(rRowBuf.iNumMBytes, cAttr::INT32, iInd_, iSkip_, iSkip_);
     ps::lib::sql::lite3::cSqliteStmt oDel(oDb_,
         "DELETE FROM TARGET_TABLES "
         "WHERE OWNER = ? "
@@ -320,9 +322,11 @@ ps::app::xtru::cTableList cTargetTables::oRmWhereNumRows(ps::lib::sql::occi::cSv
             }
             else
             {
+                // NUM_MBYTES truncates a table smaller than 1 MiB to 0, which is rounded up.
                 oTableList.push_back({
                     rRowBuf.szOwner, rRowBuf.szTable, rRowBuf.szIotType
                     , rRowBuf.iDataFmt, rRowBuf.iNumLongs, rRowBuf.iNumLobs
+                    , static_cast<int64_t>(std::max(rRowBuf.iNumMBytes, 1)) << 20
                 });
             }
         }
@@ -46,6 +46,7 @@ private:
         int32_t iDataFmt;
         int32_t iNumLongs;
         int32_t iNumLobs;
+        int32_t iNumMBytes;
         tAttributes(
             const char* szO =0
             , const char* szT =0
@@ -57,6 +58,7 @@ private:
             : iDataFmt(iD)
             , iNumLongs(iL)
             , iNumLobs(iB)
+            , iNumMBytes(0)
         {
             if (szO) strcpy(szOwner, szO);
             if (szT) strcpy(szTable, szT);
@@ -70,6 +72,7 @@ private:
             iDataFmt = rhs.iDataFmt;
             iNumLongs = rhs.iNumLongs;
             iNumLobs = rhs.iNumLobs;
+            iNumMBytes = rhs.iNumMBytes;
         }
     };
     const size_t iSkip_;
@@ -0,0 +1,277 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <pslib.h>
+#include <xtru.h>
+
+namespace ps
+{
+
+namespace app
+{
+
+namespace xtru
+{
+
+namespace getdata
+{
+
+class cPartitionedByKeyImpl
+{
+private:
+    ps::lib::cTracer& trc_;
+    const ps::lib::cConfigures& conf_;
+    ps::lib::sql::lite3::cSqliteDb& oDb_;
+    ps::lib::sql::occi::cSvc::tPtr& oSvc_;
+    const uint32_t iBulkSize_;
+    const boost::filesystem::path exec_load_;
+    const int32_t iRows_;  ///< A Number of rows at a time of loading.
+    ps::lib::tPtrFstream& st_make_sh_;
+    const std::string sAsOf_;   ///< Flashback query clause, empty if not consistent.
+    /**
+     * @struct tKey
+     * @brief
+     *   Leading column of the primary key and the upper bounds of its ranges,
+     *   the last range has no upper bound.
+     */
+    struct tKey
+    {
+        std::string sColumn;
+        ps::lib::str_vct oHiVals;
+        int64_t iNumBytes;
+    };
+    /// Key is (owner, table).
+    std::map<std::pair<std::string, std::string>, tKey> oKeys_;
+    /**
+     * @return
+     *   SQL-Select statements for each range, which number is one more than the bounds.
+     */
+    ps::lib::str_vct oGetQueries(const ps::app::xtru::cTableList::value_type& tbl, const tKey& oKey) const;
+public:
+    cPartitionedByKeyImpl(
+        ps::lib::sql::lite3::cSqliteDb& oDb
+        , ps::lib::sql::occi::cSvc::tPtr& oSvc
+        , const uint32_t& iBulkSize
+        , const int32_t& iRows
+        , ps::lib::tPtrFstream& st_make_sh
+        , const std::string& sAsOf
+    );
+    ~cPartitionedByKeyImpl();
+    bool iFind(const ps::app::xtru::cTableList::value_type& tbl) const;
+    std::string sGenerateSql(const ps::app::xtru::cTableList::value_type& tbl);
+    void vInsertUnloadTasks(
+        const ps::app::xtru::tTabName& tbl
+        , ps::lib::tSequence<ps::lib::sql::cFetchable>& unldrs
+        , const boost::filesystem::path& param_f
+    );
+};
+
+cPartitionedByKeyImpl::cPartitionedByKeyImpl(
+    ps::lib::sql::lite3::cSqliteDb& oDb
+    , ps::lib::sql::occi::cSvc::tPtr& oSvc
+    , const uint32_t& iBulkSize
+    , const int32_t& iRows
+    , ps::lib::tPtrFstream& st_make_sh
+    , const std::string& sAsOf
+)
+    : trc_(ps::lib::cTracer::get_mutable_instance())
+    , conf_(ps::lib::cConfigures::get_const_instance())
+    , oDb_(oDb)
+    , oSvc_(oSvc)
+    , iBulkSize_(iBulkSize)
+    , exec_load_(conf_.as<std::string>("exec_load"))
+    , iRows_(iRows)
+    , st_make_sh_(st_make_sh)
+    , sAsOf_(sAsOf)
+{
+    static const char sStmt[] = {
+    "SELECT T2.OWNER "
+    ", T2.TABLE_NAME "
+    ", T2.COLUMN_NAME "
+    ", T2.HIVAL "
+    ", T1.NUM_MBYTES "
+    "FROM TARGET_TABLES T0"
+    ", ALL_TABLES T1"
+    ", KEY_RANGES T2 "
+    "WHERE T1.OWNER = T0.OWNER "
+    "AND T1.TABLE_NAME = T0.TABLE_NAME "
+    "AND T2.OWNER = T1.OWNER "
+    "AND T2.TABLE_NAME = T1.TABLE_NAME "
+    "ORDER BY T2.OWNER, T2.TABLE_NAME, T2.RN "
+    };
+    struct tAttributes
+    {
+        char szOwner[OBJECT_NAME_LEN];
+        char szTableName[OBJECT_NAME_LEN];
+        char szColumnName[COLUMN_NAME_LEN];
+        char szHiVal[KEY_LITERAL_LEN];
+        int32_t iNumMBytes;
+    } rRowBuf;
+    ::memset(&rRowBuf, 0, sizeof(rRowBuf));
+    const size_t iSkip = sizeof(rRowBuf);
+    auto iNumRows = 0;
+    ps::lib::sql::lite3::cSqliteStmt oStmt(oDb_, sStmt);
+    ASSERT_OR_RAISE_FNC(oStmt.iParse() == SQLITE_OK, std::runtime_error, ps::lib::sql::lite3::cCheckErr(oDb_));
+    ps::lib::sql::lite3::cDefine& oDefine(oStmt.oGetDefine());
+    using ps::lib::sql::lite3::cAttr;
+    oDefine.vAddItem(rRowBuf.szOwner, cAttr::STR, NULL, iSkip, iSkip);
+    oDefine.vAddItem(rRowBuf.szTableName, cAttr::STR, NULL, iSkip, iSkip);
+    oDefine.vAddItem(rRowBuf.szColumnName, cAttr::STR, NULL, iSkip, iSkip);
+    oDefine.vAddItem(rRowBuf.szHiVal, cAttr::STR, NULL, iSkip, iSkip);
+    oDefine.vAddItem(rRowBuf.iNumMBytes, cAttr::INT32, NULL, iSkip, iSkip);
+    ps::lib::sql::lite3::cDirectiveHolder oDirectiveHolder(
+        [&] {
+            auto& rKey = oKeys_[std::make_pair(rRowBuf.szOwner, rRowBuf.szTableName)];
+            rKey.sColumn = rRowBuf.szColumnName;
+            rKey.oHiVals.push_back(rRowBuf.szHiVal);
+            rKey.iNumBytes = static_cast<int64_t>(rRowBuf.iNumMBytes) << 20;
+            ++iNumRows;
+        }
+        , [&] { trc_ << std::string("Start to read the key ranges of the index-organized tables.") << std::endl; }
+        , [&] { trc_ << boost::format("Finished to read and returned %d rows for %d tables.")
+            % iNumRows % oKeys_.size() << std::endl; }
+        , [&] { trc_ << std::string("Not found the key ranges.") << std::endl; }
+    );
+    ASSERT_OR_RAISE_FNC(oStmt.iFetch(oDirectiveHolder) == SQLITE_DONE
+        , std::runtime_error, ps::lib::sql::lite3::cCheckErr(oDb_));
+}
+
+cPartitionedByKeyImpl::~cPartitionedByKeyImpl()
+{}
+
+bool cPartitionedByKeyImpl::iFind(const ps::app::xtru::cTableList::value_type& tbl) const
+{
+    return oKeys_.count(std::make_pair(tbl.sOwner, tbl.sTable)) != 0;
+}
+
+ps::lib::str_vct cPartitionedByKeyImpl::oGetQueries(
+    const ps::app::xtru::cTableList::value_type& tbl
+    , const tKey& oKey
+) const {
+    ps::lib::str_vct oQueries;
+    const auto sTable = tbl.sGetConcatenatedName("\"") + sAsOf_;
+    const auto sColumn = "\"" + oKey.sColumn + "\"";
+    const std::string* pLoVal = nullptr;
+    for (const auto& sHiVal: oKey.oHiVals)
+    {
+        oQueries.push_back(pLoVal
+            ? (boost::format("SELECT * FROM %s WHERE %s > %s AND %s <= %s")
+                % sTable % sColumn % *pLoVal % sColumn % sHiVal).str()
+            : (boost::format("SELECT * FROM %s WHERE %s <= %s")
+                % sTable % sColumn % sHiVal).str()
+        );
+        pLoVal = &sHiVal;
+    }
+    // The rows beyond the sample.
+    oQueries.push_back(pLoVal
+        ? (boost::format("SELECT * FROM %s WHERE %s > %s") % sTable % sColumn % *pLoVal).str()
+        : (boost::format("SELECT * FROM %s") % sTable).str()
+    );
+    return oQueries;
+}
+
+std::string cPartitionedByKeyImpl::sGenerateSql(const ps::app::xtru::cTableList::value_type& tbl)
+{
+    const auto it = oKeys_.find(std::make_pair(tbl.sOwner, tbl.sTable));
+    BOOST_ASSERT(it != oKeys_.end());
+    std::ostringstream oss;
+    for (const auto& sql: oGetQueries(tbl, it->second))
+    {
+        oss << sql << ';';
+    }
+    oKeys_.erase(it);
+    return oss.str();
+}
+
+void cPartitionedByKeyImpl::vInsertUnloadTasks(
+    const ps::app::xtru::tTabName& tbl
+    , ps::lib::tSequence<ps::lib::sql::cFetchable>& unldrs
+    , const boost::filesystem::path& param_f
+){
+    const auto it = oKeys_.find(std::make_pair(tbl.sOwner, tbl.sTable));
+    BOOST_ASSERT(it != oKeys_.end());
+    const auto oQueries = oGetQueries(tbl, it->second);
+    const auto iNumBytes = it->second.iNumBytes;
+    oKeys_.erase(it);
+    const auto table_n(tbl.sGetConcatenatedName()); // Non-enclosing name will be return.
+    const auto file_n = ps::lib::sConvertDollar2Sharp(table_n);
+    auto iRangeNo = 0;
+    for (const auto& sql: oQueries)
+    {
+        const auto sRangeNo = (boost::format("%02d") % ++iRangeNo).str();
+        auto ptr = new ps::lib::sql::occi::cUnloader(
+            *oSvc_
+            , new ps::lib::nsStreamLocator::cStreamLocator(tbl.sOwner, file_n, sRangeNo)
+            , iBulkSize_, sql, table_n, tbl.iNumLongs
+        );
+        // The ranges are split evenly by the sampled rows.
+        ptr->vSetEstimatedBytes(iNumBytes / static_cast<int64_t>(oQueries.size()));
+        unldrs.push_back(ptr);
+        // Same as an IOT which is not split.
+        *st_make_sh_
+            << boost::format("%s parfile=%s control=%s.ctl")
+                % exec_load_
+                % param_f
+                % (file_n + "_" + sRangeNo)
+            << std::endl
+        ;
+    }
+}
+
+cPartitionedByKey::cPartitionedByKey(
+    ps::lib::sql::lite3::cSqliteDb& oDb
+    , ps::lib::sql::occi::cSvc::tPtr& oSvc
+    , const uint32_t& iBulkSize
+    , const int32_t& iRows
+    , ps::lib::tPtrFstream& st_make_sh
+    , const std::string& sAsOf
+)
+    : oImpl_(new cPartitionedByKeyImpl(oDb, oSvc, iBulkSize, iRows, st_make_sh, sAsOf))
+{}
+
+cPartitionedByKey::~cPartitionedByKey()
+{}
+
+bool cPartitionedByKey::iFind(const ps::app::xtru::cTableList::value_type& tbl) const 
+{
+    return oImpl_->iFind(tbl);
+}
+
+std::string cPartitionedByKey::sGenerateSql(const ps::app::xtru::cTableList::value_type& tbl)
+{
+    return oImpl_->sGenerateSql(tbl);
+}
+
+void cPartitionedByKey::vInsertUnloadTasks(
+    const ps::app::xtru::tTabName& tbl
+    , ps::lib::tSequence<ps::lib::sql::cFetchable>& unldrs
+    , const boost::filesystem::path& param_f
+){
+    oImpl_->vInsertUnloadTasks(tbl, unldrs, param_f);
+}
+
+} // ps::app::xtru::getdata
+
+} // ps::app::xtru
+
+} // ps::app
+
+} // ps
@@ -46,6 +46,7 @@ private:
     const boost::filesystem::path exec_load_;
     const int32_t iRows_;  ///< A Number of rows at a time of loading.
     ps::lib::tPtrFstream& st_make_sh_;
+    const std::string sAsOf_;   ///< Flashback query clause, empty if not consistent.
     struct tAttributes
     {
         char szOwner[OBJECT_NAME_LEN];             // PK1 NOT NULL VARCHAR2(30)
@@ -53,6 +54,7 @@ private:
         int32_t iRangeNo;                          // PK3 n = 1,2,3, ...
         char szRowidBgn[ROWID_STR_LEN];            // NOT NULL VARCHAR2(19)
         char szRowidEnd[ROWID_STR_LEN];            // NOT NULL VARCHAR2(19)
+        int32_t iNumMBytes;                        // Estimated size of the table.
         tAttributes(
             const char* szOwner_ =0
             , const char* szTableName_ =0
@@ -73,6 +75,7 @@ private:
             iRangeNo = rhs.iRangeNo;
             strcpy(szRowidBgn, rhs.szRowidBgn);
             strcpy(szRowidEnd, rhs.szRowidEnd);
+            iNumMBytes = rhs.iNumMBytes;
         }
         bool operator<(const tAttributes& rhs) const
         {
@@ -94,6 +97,16 @@ private:
         }
     };
     ps::lib::cList<tAttributes> oList_;
+    /**
+     * @brief
+     *   Inserts one task whose statements take the ranges in oChosen dynamically.
+     */
+    void vInsertDynamicTask(
+        const ps::app::xtru::tTabName& tbl
+        , const ps::lib::cList<tAttributes>& oChosen
+        , ps::lib::tSequence<ps::lib::sql::cFetchable>& unldrs
+        , const boost::filesystem::path& param_f
+    );
     void oSelectMatchedAndRemove(const ps::app::xtru::cTableList::value_type& tbl, ps::lib::cList<tAttributes>& oChosen)
     {
         std::copy_if(oList_.cbegin(), oList_.cend(), std::back_inserter(oChosen), tbl);
@@ -108,6 +121,7 @@ public:
         , const uint32_t& iBulkSize
         , const int32_t& iRows
         , ps::lib::tPtrFstream& st_make_sh
+        , const std::string& sAsOf
     );
     ~cPartitionedByRowidImpl();
     bool iFind(const ps::app::xtru::cTableList::value_type& tbl) const;
@@ -133,6 +147,7 @@ cPartitionedByRowidImpl::cPartitionedByRowidImpl(
     , const uint32_t& iBulkSize
     , const int32_t& iRows
     , ps::lib::tPtrFstream& st_make_sh
+    , const std::string& sAsOf
 )
     : trc_(ps::lib::cTracer::get_mutable_instance())
     , conf_(ps::lib::cConfigures::get_const_instance())
@@ -143,6 +158,7 @@ cPartitionedByRowidImpl::cPartitionedByRowidImpl(
     , exec_load_(conf_.as<std::string>("exec_load"))
     , iRows_(iRows)
     , st_make_sh_(st_make_sh)
+    , sAsOf_(sAsOf)
 {
     static const char sStmt[] = {
     "SELECT T2.OWNER "
@@ -150,6 +166,7 @@ cPartitionedByRowidImpl::cPartitionedByRowidImpl(
     ", T2.RN AS RN "
     ", T2.PREDB AS PREDB "
     ", T2.PREDE AS PREDE "
+    ", T1.NUM_MBYTES "
     "FROM TARGET_TABLES T0"
     ", ALL_TABLES T1"
     ", ROWID_RANGES T2 "
@@ -157,6 +174,7 @@ cPartitionedByRowidImpl::cPartitionedByRowidImpl(
     "AND T1.TABLE_NAME = T0.TABLE_NAME "
     "AND T2.OWNER = T1.OWNER "
     "AND T2.SEGMENT_NAME = T1.TABLE_NAME "
+    "AND T2.PARTITION_NAME = ' ' "
     "AND T1.PARTITIONED = 'NO' "
     "AND T1.NUM_MBYTES >= ? "
     };
@@ -173,6 +191,7 @@ cPartitionedByRowidImpl::cPartitionedByRowidImpl(
     oDefine.vAddItem(rRowBuf.iRangeNo, cAttr::INT32, NULL, iSkip_, iSkip_);
     oDefine.vAddItem(rRowBuf.szRowidBgn, cAttr::STR, NULL, iSkip_, iSkip_);
     oDefine.vAddItem(rRowBuf.szRowidEnd, cAttr::STR, NULL, iSkip_, iSkip_);
+    oDefine.vAddItem(rRowBuf.iNumMBytes, cAttr::INT32, NULL, iSkip_, iSkip_);
     ps::lib::sql::lite3::cBind& oBind(oStmt.oGetBind());
     oBind.vAddItem(iNumMBytes, cAttr::INT32, &iNumMBytesInd, 0, 0);
     ps::lib::sql::lite3::cDirectiveHolder oDirectiveHolder(
@@ -202,7 +221,7 @@ std::string cPartitionedByRowidImpl::sGenerateSql(const ps::app::xtru::cTableLis
     for (const auto& rRowBuf: oChosen)
     {
         oss << boost::format(szQuery)
-            % tbl.sGetConcatenatedName("\"") 
+            % (tbl.sGetConcatenatedName("\"") + sAsOf_)
             % rRowBuf.szRowidBgn
             % rRowBuf.szRowidEnd
             << ';';
@@ -217,12 +236,19 @@ void cPartitionedByRowidImpl::vInsertUnloadTasks(
 ){
     ps::lib::cList<tAttributes> oChosen;
     oSelectMatchedAndRemove(tbl, oChosen);
+    // The lengths of LONG and LOB columns written to the control file
+    // are gathered by each statement, so that they are not replaced.
+    if (conf_.as<bool>("rowid_split_dynamic") && tbl.iNumLongs == 0 && tbl.iNumLobs == 0)
+    {
+        vInsertDynamicTask(tbl, oChosen, unldrs, param_f);
+        return;
+    }
     std::ostringstream oss;
     for (const auto& rRowBuf: oChosen)
     {
         // SQL for tables that are not split and extracted.
         oss << boost::format(szQuery)
-            % tbl.sGetConcatenatedName("\"") 
+            % (tbl.sGetConcatenatedName("\"") + sAsOf_)
             % rRowBuf.szRowidBgn
             % rRowBuf.szRowidEnd
             ;
@@ -233,6 +259,8 @@ void cPartitionedByRowidImpl::vInsertUnloadTasks(
             , new ps::lib::nsStreamLocator::cStreamLocator(tbl.sOwner, file_n, rRowBuf.sGetRangeNo())
             , iBulkSize_, oss.str(), table_n, tbl.iNumLongs
         );
+        // The ranges are split evenly by blocks.
+        ptr->vSetEstimatedBytes((static_cast<int64_t>(rRowBuf.iNumMBytes) << 20) / oChosen.size());
         unldrs.push_back(ptr);
         oss.str("");
         const auto fname = ps::lib::sConvertDollar2Sharp(tbl.sGetConcatenatedName()) + "_" + rRowBuf.sGetRangeNo();
@@ -254,14 +282,66 @@ void cPartitionedByRowidImpl::vInsertUnloadTasks(
     }
 }
 
+void cPartitionedByRowidImpl::vInsertDynamicTask(
+    const ps::app::xtru::tTabName& tbl
+    , const ps::lib::cList<tAttributes>& oChosen
+    , ps::lib::tSequence<ps::lib::sql::cFetchable>& unldrs
+    , const boost::filesystem::path& param_f
+){
+    const auto iNumLanes = conf_.as<int32_t>("rowid_split_num_parts");
+    std::unique_ptr<ps::lib::sql::occi::cRowidSplitter> oSplitter(
+        new ps::lib::sql::occi::cRowidSplitter(
+            tbl.sGetConcatenatedName("\"") + sAsOf_, iNumLanes, conf_.as<int32_t>("rowid_split_min_blocks")
+        )
+    );
+    for (const auto& rRowBuf: oChosen)
+    {
+        oSplitter->vAddRange(rRowBuf.szRowidBgn, rRowBuf.szRowidEnd);
+    }
+    // The first range of each statement, the rest are taken while fetching.
+    std::ostringstream oss;
+    std::string sql;
+    for (auto i = 0; i < iNumLanes && oSplitter->iTake(sql); ++i)
+    {
+        oss << sql << ';';
+    }
+    const auto table_n(tbl.sGetConcatenatedName()); // Non-enclosing name will be return.
+    const auto file_n = ps::lib::sConvertDollar2Sharp(table_n);
+    auto ptr = new ps::lib::sql::occi::cUnloader(
+        *oSvc_
+        , new ps::lib::nsStreamLocator::cStreamLocator(tbl.sOwner, file_n, "" /*sPartitionName*/)
+        , iBulkSize_, oss.str(), table_n, tbl.iNumLongs
+    );
+    ptr->vSetRowidSplitter(oSplitter.release());
+    ptr->vSetEstimatedBytes(oChosen.size() ? static_cast<int64_t>(oChosen.cbegin()->iNumMBytes) << 20 : 0);
+    unldrs.push_back(ptr);
+    // All ranges are written to one data file.
+    *st_make_sh_
+        << (
+          ("IOT" == tbl.sIotType)
+          ? boost::format("%s parfile=%s control=%s.ctl")
+              % exec_load_
+              % param_f
+              % file_n
+          : boost::format("%s parfile=%s rows=%d control=%s.ctl")
+              % exec_load_
+              % param_f
+              % iRows_
+              % file_n
+        )
+        << std::endl
+    ;
+}
+
 cPartitionedByRowid::cPartitionedByRowid(
     ps::lib::sql::lite3::cSqliteDb& oDb
     , ps::lib::sql::occi::cSvc::tPtr& oSvc
     , const uint32_t& iBulkSize
     , const int32_t& iRows
     , ps::lib::tPtrFstream& st_make_sh
+    , const std::string& sAsOf
 )
-    : oImpl_(new cPartitionedByRowidImpl(oDb, oSvc, iBulkSize, iRows, st_make_sh))
+    : oImpl_(new cPartitionedByRowidImpl(oDb, oSvc, iBulkSize, iRows, st_make_sh, sAsOf))
 {}
 
 cPartitionedByRowid::~cPartitionedByRowid()
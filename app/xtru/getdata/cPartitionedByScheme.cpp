@@ -38,6 +38,8 @@ class cPartitionedBySchemeImpl
 {
 private:
     const static char szQuery[];
+    const static char szRangeQuery[];
+    const static char szTable[];
     ps::lib::cTracer& trc_;
     const ps::lib::cConfigures& conf_;         /// This will activate but not in used.
     const ps::lib::cDelimiter oDelim_;
@@ -48,6 +50,19 @@ private:
     const boost::filesystem::path exec_load_;
     const int32_t iRows_;  ///< A Number of rows at a time of loading.
     ps::lib::tPtrFstream& st_make_sh_;
+    const std::string sAsOf_;   ///< Flashback query clause, empty if not consistent.
+    const int64_t iSplitMinBytes_;  ///< Partitions larger than this are split by rowid range, 0 disables it.
+    /// Key is (owner, table, partition) and value is the list of (PREDB, PREDE).
+    typedef std::map<
+        std::tuple<std::string, std::string, std::string>
+        , std::vector<std::pair<std::string, std::string>>
+    > tRanges;
+    tRanges oRanges_;
+    /**
+     * @brief
+     *   Reads the rowid ranges of partitions and subpartitions from ROWID_RANGES.
+     */
+    void vLoadRowidRanges();
     struct tAttributes
     {
         char szOwnerName[OBJECT_NAME_LEN];
@@ -111,6 +126,7 @@ public:
         , const uint32_t& iBulkSize
         , const int32_t& iRows
         , ps::lib::tPtrFstream& st_make_sh
+        , const std::string& sAsOf
     );
     ~cPartitionedBySchemeImpl();
     bool iFind(const ps::app::xtru::cTableList::value_type& tbl) const ;
@@ -128,7 +144,9 @@ public:
     );
 };
 
-const char cPartitionedBySchemeImpl::szQuery[] = {"SELECT * FROM %s %s(\"%s\")"};
+const char cPartitionedBySchemeImpl::szQuery[] = {"SELECT * FROM %s"};
+const char cPartitionedBySchemeImpl::szRangeQuery[] = {"SELECT * FROM %s WHERE ROWID BETWEEN '%s' AND '%s'"};
+const char cPartitionedBySchemeImpl::szTable[] = {"%s %s(\"%s\")%s"};
 
 cPartitionedBySchemeImpl::cPartitionedBySchemeImpl(
     ps::lib::sql::lite3::cSqliteDb& oDb
@@ -136,6 +154,7 @@ cPartitionedBySchemeImpl::cPartitionedBySchemeImpl(
     , const uint32_t& iBulkSize
     , const int32_t& iRows
     , ps::lib::tPtrFstream& st_make_sh
+    , const std::string& sAsOf
 )
     : trc_(ps::lib::cTracer::get_mutable_instance())
     , conf_(ps::lib::cConfigures::get_const_instance())
@@ -147,6 +166,8 @@ cPartitionedBySchemeImpl::cPartitionedBySchemeImpl(
     , exec_load_(conf_.as<std::string>("exec_load"))
     , iRows_(iRows)
     , st_make_sh_(st_make_sh)
+    , sAsOf_(sAsOf)
+    , iSplitMinBytes_(ps::lib::iIntStrToBinInt<int64_t>(conf_.as<std::string>("rowid_split_min_size")))
 {
     static const char sStmt[] = {
     "SELECT T1.TABLE_OWNER "
@@ -193,11 +214,65 @@ cPartitionedBySchemeImpl::cPartitionedBySchemeImpl(
     );
     ASSERT_OR_RAISE_FNC(oStmt.iFetch(oDirectiveHolder) == SQLITE_DONE
         , std::runtime_error, ps::lib::sql::lite3::cCheckErr(oDb_));
+    if (iSplitMinBytes_ > 0)
+    {
+        vLoadRowidRanges();
+    }
 }
 
 cPartitionedBySchemeImpl::~cPartitionedBySchemeImpl()
 {}
 
+void cPartitionedBySchemeImpl::vLoadRowidRanges()
+{
+    static const char sStmt[] = {
+    "SELECT T2.OWNER "
+    ", T2.SEGMENT_NAME "
+    ", T2.PARTITION_NAME "
+    ", T2.PREDB "
+    ", T2.PREDE "
+    "FROM TARGET_TABLES T0 "
+    ", ROWID_RANGES T2 "
+    "WHERE T2.OWNER = T0.OWNER "
+    "AND T2.SEGMENT_NAME = T0.TABLE_NAME "
+    "AND T2.PARTITION_NAME <> ' ' "
+    "ORDER BY T2.OWNER, T2.SEGMENT_NAME, T2.PARTITION_NAME, T2.SUBPARTITION_NAME, T2.RN "
+    };
+    struct tRange
+    {
+        char szOwner[OBJECT_NAME_LEN];
+        char szTableName[OBJECT_NAME_LEN];
+        char szPartitionName[OBJECT_NAME_LEN];
+        char szRowidBgn[ROWID_STR_LEN];
+        char szRowidEnd[ROWID_STR_LEN];
+    } rRowBuf;
+    ::memset(&rRowBuf, 0, sizeof(rRowBuf));
+    const size_t iSkip = sizeof(rRowBuf);
+    int64_t iNumRows = 0;
+    ps::lib::sql::lite3::cSqliteStmt oStmt(oDb_, sStmt);
+    ASSERT_OR_RAISE_FNC(oStmt.iParse() == SQLITE_OK, std::runtime_error, ps::lib::sql::lite3::cCheckErr(oDb_));
+    ps::lib::sql::lite3::cDefine& oDefine(oStmt.oGetDefine());
+    using ps::lib::sql::lite3::cAttr;
+    oDefine.vAddItem(rRowBuf.szOwner, cAttr::STR, NULL, iSkip, iSkip);
+    oDefine.vAddItem(rRowBuf.szTableName, cAttr::STR, NULL, iSkip, iSkip);
+    oDefine.vAddItem(rRowBuf.szPartitionName, cAttr::STR, NULL, iSkip, iSkip);
+    oDefine.vAddItem(rRowBuf.szRowidBgn, cAttr::STR, NULL, iSkip, iSkip);
+    oDefine.vAddItem(rRowBuf.szRowidEnd, cAttr::STR, NULL, iSkip, iSkip);
+    ps::lib::sql::lite3::cDirectiveHolder oDirectiveHolder(
+        [&] {
+            oRanges_[std::make_tuple(rRowBuf.szOwner, rRowBuf.szTableName, rRowBuf.szPartitionName)]
+                .emplace_back(rRowBuf.szRowidBgn, rRowBuf.szRowidEnd);
+            ++iNumRows;
+        }
+        , [&] { trc_ << std::string("Start to read the rowid ranges of the partitions.") << std::endl; }
+        , [&] { trc_ << boost::format("Finished to read and returned %d rows for %d partitions.")
+            % iNumRows % oRanges_.size() << std::endl; }
+        , [&] { trc_ << std::string("Not found the rowid ranges of the partitions.") << std::endl; }
+    );
+    ASSERT_OR_RAISE_FNC(oStmt.iFetch(oDirectiveHolder) == SQLITE_DONE
+        , std::runtime_error, ps::lib::sql::lite3::cCheckErr(oDb_));
+}
+
 bool cPartitionedBySchemeImpl::iFind(const ps::app::xtru::cTableList::value_type& tbl) const 
 {
     return std::find_if( oList_.cbegin(), oList_.cend(), tbl) != oList_.cend();
@@ -211,9 +286,12 @@ std::string cPartitionedBySchemeImpl::sGenerateSql(const ps::app::xtru::cTableLi
     for (const auto& rRowBuf: oChosen)
     {
         oss << boost::format(szQuery)
-            % tbl.sGetConcatenatedName("\"") 
-            % rRowBuf.szObjectType
-            % rRowBuf.szPartitionName
+            % (boost::format(szTable)
+                % tbl.sGetConcatenatedName("\"")
+                % rRowBuf.szObjectType
+                % rRowBuf.szPartitionName
+                % sAsOf_
+            )
             << ';';
     }
     return oss.str();
@@ -229,11 +307,55 @@ void cPartitionedBySchemeImpl::vInsertUnloadTasks(
     std::ostringstream oss;
     for (const auto& rRowBuf: oChosen)
     {
-        oss << boost::format(szQuery)
-            % tbl.sGetConcatenatedName("\"") 
+        const auto sTable = (boost::format(szTable)
+            % tbl.sGetConcatenatedName("\"")
             % rRowBuf.szObjectType
             % rRowBuf.szPartitionName
-            << ';';
+            % sAsOf_
+        ).str();
+        const auto it = oRanges_.find(std::make_tuple(tbl.sOwner, tbl.sTable, std::string(rRowBuf.szPartitionName)));
+        // An oversized partition is read by several rowid ranges,
+        // but they are written into one data file of the partition.
+        const bool iSplit = iSplitMinBytes_ > 0
+            && rRowBuf.fNumBytes >= static_cast<double>(iSplitMinBytes_)
+            && it != oRanges_.cend() && it->second.size() > 1;
+        // The lengths of LONG and LOB columns written to the control file
+        // are gathered by each statement, so that they are not replaced.
+        const bool iDynamic = iSplit
+            && conf_.as<bool>("rowid_split_dynamic") && tbl.iNumLongs == 0 && tbl.iNumLobs == 0;
+        std::unique_ptr<ps::lib::sql::occi::cRowidSplitter> oSplitter;
+        if (iDynamic)
+        {
+            const auto iNumLanes = conf_.as<int32_t>("rowid_split_num_parts");
+            oSplitter.reset(new ps::lib::sql::occi::cRowidSplitter(
+                sTable, iNumLanes, conf_.as<int32_t>("rowid_split_min_blocks")
+            ));
+            for (const auto& rRange: it->second)
+            {
+                oSplitter->vAddRange(rRange.first, rRange.second);
+            }
+            // The first range of each statement, the rest are taken while fetching.
+            std::string sql;
+            for (auto i = 0; i < iNumLanes && oSplitter->iTake(sql); ++i)
+            {
+                oss << sql << ';';
+            }
+        }
+        else if (iSplit)
+        {
+            for (const auto& rRange: it->second)
+            {
+                oss << boost::format(szRangeQuery)
+                    % sTable
+                    % rRange.first
+                    % rRange.second
+                    << ';';
+            }
+        }
+        else
+        {
+            oss << boost::format(szQuery) % sTable << ';';
+        }
         const auto table_n(tbl.sGetConcatenatedName()); // Non-enclosing name will be return.
         const auto file_n = ps::lib::sConvertDollar2Sharp(table_n);
         auto ptr = new ps::lib::sql::occi::cUnloader(
@@ -241,6 +363,11 @@ void cPartitionedBySchemeImpl::vInsertUnloadTasks(
             , new ps::lib::nsStreamLocator::cStreamLocator(tbl.sOwner, file_n, rRowBuf.szPartitionName)
             , iBulkSize_, oss.str(), table_n, tbl.iNumLongs
         );
+        if (oSplitter)
+        {
+            ptr->vSetRowidSplitter(oSplitter.release());
+        }
+        ptr->vSetEstimatedBytes(static_cast<int64_t>(rRowBuf.fNumBytes));
         unldrs.push_back(ptr);
         oss.str("");
         const auto fname = ps::lib::sConvertDollar2Sharp(tbl.sGetConcatenatedName()) + "_" + rRowBuf.szPartitionName;
@@ -268,8 +395,9 @@ cPartitionedByScheme::cPartitionedByScheme(
     , const uint32_t& iBulkSize
     , const int32_t& iRows
     , ps::lib::tPtrFstream& st_make_sh
+    , const std::string& sAsOf
 )
-    : oImpl_(new cPartitionedBySchemeImpl(oDb, oSvc, iBulkSize, iRows, st_make_sh))
+    : oImpl_(new cPartitionedBySchemeImpl(oDb, oSvc, iBulkSize, iRows, st_make_sh, sAsOf))
 {}
 
 cPartitionedByScheme::~cPartitionedByScheme()
@@ -44,6 +44,7 @@ public:
         , const uint32_t& iBulkSize
         , const int32_t& iRows
         , ps::lib::tPtrFstream& st_make_sh
+        , const std::string& sAsOf
     );
     ~cPartitionedByScheme();
     bool iFind(const ps::app::xtru::cTableList::value_type& tbl) const ;
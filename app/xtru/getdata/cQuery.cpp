@@ -45,6 +45,93 @@ private:
     const int32_t iRows_;  ///< A Number of rows at a time of loading.
     ps::lib::tPtrFstream st_make_sh_;
     ps::lib::sql::occi::cBind oBind_;
+    const int32_t iSplitParts_;  ///< Number of statements a query is split into, 0 or 1 disables it.
+    /**
+     * @brief
+     *   Rewrites a query over one driving table into iSplitParts_ statements.
+     *   The driving table, the first one after FROM, is replaced with
+     *   an inline view which takes the rows of ORA_HASH(ROWID, N-1) = k.
+     * @param[in] sSelect
+     * @param[out] sSplit
+     *   Statements separated by semi-colons.
+     * @return
+     *   false if the query can not be split without changing its result,
+     *   such as aggregations, ordering or outer joins.
+     */
+    bool iSplitByHash(const std::string& sSelect, std::string& sSplit) const
+    {
+        const auto sql = boost::trim_right_copy_if(sSelect, boost::is_any_of("; \t\r\n"));
+        // (?i:(A)) maches both "A" and "a".
+        const boost::regex unsplittable_re_(
+            R"(;|\(\+\)|\b(?i:(GROUP|ORDER|CONNECT|DISTINCT|UNIQUE|ROWNUM|UNION|INTERSECT|MINUS|FETCH|OVER|RIGHT|FULL)\b))"
+            R"(|\b(?i:(COUNT|SUM|AVG|MIN|MAX|LISTAGG|MEDIAN|STDDEV|VARIANCE))\s*\()"
+        );
+        const boost::regex driving_re_(
+            R"((?<front_part>^\s*(?i:(SELECT))\s+.+?\s+(?i:(FROM))\s+))"
+            R"((?<table_name>(?:"[^"]+"|[\w$#]+)(?:\.(?:"[^"]+"|[\w$#]+))?))"
+            R"((?<back_part>(?:\s+(?<next_word>[\w$#]+))?.*)$)"
+        );
+        const boost::regex keyword_re_(
+            R"((?i:(WHERE|JOIN|INNER|LEFT|CROSS|NATURAL)))"
+        );
+        const boost::regex clause_re_(
+            R"((?i:(PARTITION|SUBPARTITION|SAMPLE|AS|VERSIONS)))"
+        );
+        const boost::regex select_re_(R"(\b(?i:(SELECT))\b)");
+        boost::smatch result;
+        // A subquery may have another FROM before the driving table.
+        if (std::distance(boost::sregex_iterator(sql.begin(), sql.end(), select_re_), boost::sregex_iterator()) > 1)
+        {
+            trc_ << std::string("The query is not split because it has subqueries.") << std::endl;
+            return false;
+        }
+        if (boost::regex_search(sql, result, unsplittable_re_))
+        {
+            trc_ << boost::format("The query is not split because of \"%s\".") % result[0] << std::endl;
+            return false;
+        }
+        if ( ! boost::regex_match(sql, result, driving_re_, boost::match_single_line))
+        {
+            trc_ << std::string("The query is not split because the driving table is not found.") << std::endl;
+            return false;
+        }
+        std::string sAlias;
+        if (result["next_word"].matched)
+        {
+            const std::string next = result["next_word"];
+            if (boost::regex_match(next, clause_re_))
+            {
+                trc_ << boost::format("The query is not split because of \"%s\".") % next << std::endl;
+                return false;
+            }
+            if (boost::regex_match(next, keyword_re_))
+            {
+                sAlias = result["table_name"];
+            }
+        }
+        else
+        {
+            sAlias = result["table_name"];
+        }
+        if ( ! sAlias.empty())
+        {
+            // The columns qualified by the table name are still available.
+            sAlias = " " + sAlias.substr(sAlias.find_last_of('.') + 1);
+        }
+        std::ostringstream oss;
+        for (auto k = 0; k < iSplitParts_; ++k)
+        {
+            oss << result["front_part"]
+                << boost::format("(SELECT * FROM %s WHERE ORA_HASH(ROWID, %d) = %d)%s")
+                    % result["table_name"] % (iSplitParts_ - 1) % k % sAlias
+                << result["back_part"]
+                << ';';
+        }
+        sSplit = oss.str();
+        trc_ << boost::format("The query is split into %d statements by the driving table %s.")
+            % iSplitParts_ % result["table_name"] << std::endl;
+        return true;
+    }
     void vPrintExecLoader(const std::string& fname)
     {
         const auto param_f(sGetParfName(true));
@@ -61,7 +148,18 @@ private:
         , const std::string& sSelect
         , const std::string& file_n
     ){
-        if (partitioning_ & SCHEMA_BASED_PARTITIONING)
+        std::string sSplit;
+        if (iSplitParts_ > 1 && iSplitByHash(sSelect, sSplit))
+        {
+            // The statements are written into one data file, like a single query.
+            unldrs_.push_back(new ps::lib::sql::occi::cUnloader(
+                *oSvc_
+                , new ps::lib::nsStreamLocator::cStreamLocator(sOwner, file_n, "" /*sPartitionName*/)
+                , iBulkSize_, sSplit, file_n, ps::lib::sql::occi::cUnloader::NO_LONG_COLUMN, &oBind_
+            ));
+            vPrintExecLoader(file_n);
+        }
+        else if (partitioning_ & SCHEMA_BASED_PARTITIONING)
         {
             ps::lib::tSep sep("\\", ";", "");
             boost::tokenizer< ps::lib::tSep > tokens(sSelect, sep);
@@ -237,6 +335,7 @@ public:
     cQueryImpl()
         : sTag_("Query")
         , iRows_(100000)
+        , iSplitParts_(conf_.as<int32_t>("query_split_num_parts"))
     {
         mos_ << boost::format("*** Started %s ***") % sTag_ << std::endl;
         mos_ << boost::format("Importing parameter value(s) from %s")
@@ -108,6 +108,69 @@ cStartValues::cStartValues()
         , {{dataext_, "ctl", extnameclob_, extnameblob_}}
         , suppress_ctrlf_ // True means suppressing the controlfile outputting.
     );
+    // Parameters of the compressing schemes, e.g. "gzip://{O}/{C}.{X}.gz".
+    ps::lib::nsStreamLocator::vSetCompression(
+        conf_.as<int32_t>("compress_level")
+        , ps::lib::iIntStrToBinInt<int64_t>(conf_.as<std::string>("compress_frame_size"))
+        , conf_.as<int32_t>("compress_threads")
+    );
+    // Parameters of the file scheme, e.g. "file://{O}/{C}.{X}".
+    ps::lib::nsStreamLocator::vSetWriteback(
+        conf_.as<bool>("preallocate")
+        , ps::lib::iIntStrToBinInt<int64_t>(conf_.as<std::string>("writeback_window"))
+    );
+    // Parameters of the ipc_pipe and named_pipe schemes, e.g. "ipc_pipe://sqlldr ...".
+    ps::lib::nsStreamLocator::vSetPipe(
+        ps::lib::iIntStrToBinInt<int64_t>(conf_.as<std::string>("pipe_size"))
+    );
+    // Parameters of the direct scheme, e.g. "direct://{O}/{C}.{X}".
+    ps::lib::nsStreamLocator::vSetDirectIo(
+        ps::lib::iIntStrToBinInt<int64_t>(conf_.as<std::string>("overlap_buffer_length"))
+        , conf_.as<int32_t>("io_overlap_scale")
+    );
+    // Directories among which the data files are placed, e.g. "file://{A}/{C}.{X}".
+    {
+        std::vector<std::string> oDirs;
+        std::vector<boost::filesystem::path> oPaths;
+        boost::split(oDirs, dfile_alt_dirs_.string(), boost::is_any_of(","), boost::token_compress_on);
+        for (const auto& sDir: oDirs)
+        {
+            if (sDir.empty())
+            {
+                continue;
+            }
+            const boost::filesystem::path oPath(sDir);
+            oPaths.push_back(oPath.is_relative() ? output_ / oPath : oPath);
+        }
+        if ( ! oPaths.empty() && ! boost::contains(stream_locator_, "{A}"))
+        {
+            mos_ << "dfile_alt_dirs is ignored, because stream_locator does not contain {A}." << std::endl;
+        }
+        ps::lib::nsStreamLocator::cPlacement::get_mutable_instance().vSetDirectories(
+            oPaths
+            , ps::lib::iIntStrToBinInt<int64_t>(conf_.as<std::string>("minimum_free_size"))
+            , ps::lib::iIntStrToBinInt<int64_t>(conf_.as<std::string>("filesize"))
+        );
+    }
+    // Opening the run manifest, which makes it possible to restart from the rerunpoint.
+    boost::filesystem::path rerunpoint(conf_.as<std::string>("rerunpoint"));
+    if ( ! rerunpoint.empty() && rerunpoint.is_relative())
+    {
+        rerunpoint = output_ / rerunpoint;
+    }
+    ASSERT_OR_RAISE( ! conf_.as<bool>("incremental") || ! rerunpoint.empty()
+        , std::runtime_error, "FAILED: incremental requires rerunpoint.");
+    ps::lib::cManifest::get_mutable_instance().vOpen(
+        rerunpoint, conf_.as<bool>("restart"), conf_.as<bool>("incremental")
+    );
+    if ( ! rerunpoint.empty())
+    {
+        mos_ << boost::format("rerunpoint is %s%s%s")
+            % rerunpoint
+            % (conf_.as<bool>("restart") ? " (restarting)" : "")
+            % (conf_.as<bool>("incremental") ? " (incremental)" : "")
+            << std::endl;
+    }
     ASSERT_OR_RAISE(4 >= partitioning_ && 0 <= partitioning_
         , std::runtime_error, boost::format("FAILED: Out of range. Acutually specified %d.") % partitioning_);
     /*
@@ -121,6 +184,56 @@ cStartValues::cStartValues()
 cStartValues::~cStartValues()
 {}
 
+/**
+ * @details
+ */
+void cStartValues::vSettleScn()
+{
+    auto& oManifest(ps::lib::cManifest::get_mutable_instance());
+    auto iScn = conf_.as<int64_t>("fbqscn");
+    const auto fbqtime = conf_.as<std::string>("fbqtime");
+    if (iScn == 0 && oManifest.iGetScn())
+    {
+        // The tasks completed by the previous run have been read as of it.
+        iScn = oManifest.iGetScn();
+    }
+    // An incremental run records the SCN as the baseline of the next run.
+    else if (iScn == 0 && (fbqtime.size() || conf_.as<bool>("consistent") || conf_.as<bool>("incremental")))
+    {
+        static const std::string sPls =
+            "begin "
+                ":b_scn := %s; "
+            "end; "
+        ;
+        const auto sExpr = fbqtime.empty()
+            ? std::string("dbms_flashback.get_system_change_number")
+            : (boost::format("timestamp_to_scn(to_timestamp('%s', 'YYYY-MM-DD HH24:MI:SS'))")
+                % boost::replace_all_copy(fbqtime, "'", "''")).str();
+        ps::lib::sql::occi::cBind oBind;
+        oBind.vAddItem(":b_scn", &iScn);
+        std::unique_ptr<ps::lib::sql::occi::cStmt> oOcci(
+            new ps::lib::sql::occi::cStmt(*oSvc_, 1, sPls, "SCN", &oBind)
+        );
+        oOcci->vConvPlaceHolder({sExpr});
+        oOcci->vExecute();
+    }
+    if (iScn && conf_.as<bool>("incremental"))
+    {
+        // ORA_ROWSCN, which restricts a delta, is not supported by a flashback query.
+        // The current rows are read instead, and they include every row changed up to the SCN,
+        // so that the next delta may select a row again but never misses one.
+        oManifest.vSetScn(iScn);
+        mos_ << boost::format("All tables are unloaded without AS OF, the baseline of the next run is SCN %d.")
+            % iScn << std::endl;
+    }
+    else if (iScn)
+    {
+        sAsOf_ = (boost::format(" AS OF SCN %d") % iScn).str();
+        oManifest.vSetScn(iScn);
+        mos_ << boost::format("All tables are unloaded AS OF SCN %d.") % iScn << std::endl;
+    }
+}
+
 /**
  * @details
  */
@@ -70,8 +70,19 @@ protected:
     ;
     const std::string sSuffixDeps_;
     const std::string sSuffixRefs_;
+    /// Flashback query clause like " AS OF SCN n", which follows the table name. Empty if not consistent.
+    std::string sAsOf_;
     cStartValues();
     ~cStartValues();
+    /**
+     * @brief
+     *   Settles the SCN which all tables are unloaded as of, and sets @ref sAsOf_.
+     *   The precedence is fbqscn, the SCN recorded in the rerunpoint when restarted,
+     *   fbqtime, and the current SCN if consistent or incremental is enabled.
+     *   If incremental is enabled, the SCN is only recorded as the next baseline
+     *   and @ref sAsOf_ stays empty, because ORA_ROWSCN cannot be used in a flashback query.
+     */
+    void vSettleScn();
     /**
      * @brief
      * @param[in] iCondition
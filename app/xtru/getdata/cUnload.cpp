@@ -56,11 +56,13 @@ private:
     ){
         const auto table_n(tbl.sGetConcatenatedName()); // Non-enclosing name will be return.
         const auto file_n = ps::lib::sConvertDollar2Sharp(table_n);
-        return new ps::lib::sql::occi::cUnloader(
+        auto ptr = new ps::lib::sql::occi::cUnloader(
             *oSvc_
             , new ps::lib::nsStreamLocator::cStreamLocator(tbl.sOwner, file_n , "" /*sPartitionName*/)
            , iBulkSize_ , sSelect, table_n, tbl.iNumLongs
         );
+        ptr->vSetEstimatedBytes(tbl.iNumBytes);
+        return ptr;
     }
     void vPrintExecLoader(const ps::app::xtru::tTabName& tbl)
     {
@@ -106,9 +108,11 @@ private:
     void vSubmitUnloadSchedule(const ps::app::xtru::cTableList& oTableList)
     {
         // oScheme_ contains data for dividing the table for each partition.
-        ps::app::xtru::getdata::cPartitionedByScheme oScheme_(oDb_, oSvc_, iBulkSize_, iRows_, st_make_sh_);
+        ps::app::xtru::getdata::cPartitionedByScheme oScheme_(oDb_, oSvc_, iBulkSize_, iRows_, st_make_sh_, sAsOf_);
         // ORowid_ contains data for dividing the table into a plurality of chunks in the ROWID range.
-        ps::app::xtru::getdata::cPartitionedByRowid oRowid_(oDb_, oSvc_, iBulkSize_, iRows_, st_make_sh_);
+        ps::app::xtru::getdata::cPartitionedByRowid oRowid_(oDb_, oSvc_, iBulkSize_, iRows_, st_make_sh_, sAsOf_);
+        // oKey_ contains data for dividing the index-organized table into ranges of its primary key.
+        ps::app::xtru::getdata::cPartitionedByKey oKey_(oDb_, oSvc_, iBulkSize_, iRows_, st_make_sh_, sAsOf_);
         for (const ps::app::xtru::tTabName& tbl : oTableList)
         {
             if (oScheme_.iFind(tbl))
@@ -119,15 +123,52 @@ private:
             {
                 vTaskEntry(oRowid_, partitioning_ & ROWID_BASED_PARTITIONING, tbl);
             }
+            else if (oKey_.iFind(tbl))
+            {
+                // IOTs can not be split by ROWID, the key ranges take the place of them.
+                vTaskEntry(oKey_, partitioning_ & ROWID_BASED_PARTITIONING, tbl);
+            }
             else
             {
                 // SQL for tables that are not split and extracted.
-                const auto sStmt = "SELECT * FROM " + tbl.sGetConcatenatedName("\"");
+                const auto sStmt = "SELECT * FROM " + tbl.sGetConcatenatedName("\"") + sAsOf_;
                 unldrs_.push_back(oSubmitWithSqlStmt(sStmt, tbl));
                 vPrintExecLoader(tbl);
             }
         }
     }
+    /**
+     * Reorders the tasks in the longest processing time first manner,
+     * across all tables, partitions and rowid ranges.
+     * - A huge partition is started first instead of being queued behind
+     *   many small tables, so that it does not prolong the tail of the run.
+     * - The order of the tasks of the same estimation is kept.
+     */
+    void vOrderByLongestFirst()
+    {
+        std::vector<ps::lib::sql::cFetchable*> oOrder;
+        oOrder.reserve(unldrs_.size());
+        while (! unldrs_.empty())
+        {
+            oOrder.push_back(unldrs_.pop_front().release());
+        }
+        std::stable_sort(oOrder.begin(), oOrder.end()
+            , [](const ps::lib::sql::cFetchable* lhs, const ps::lib::sql::cFetchable* rhs)
+            {
+                return lhs->iGetEstimatedBytes() > rhs->iGetEstimatedBytes();
+            }
+        );
+        auto iTotal = 0LL;
+        for (auto ptr: oOrder)
+        {
+            iTotal += ptr->iGetEstimatedBytes();
+            unldrs_.push_back(ptr);
+        }
+        trc_ << boost::format("Estimated %s bytes in %d task(s), the largest is %s bytes.")
+            % ps::lib::sIntToa(iTotal) % unldrs_.size()
+            % ps::lib::sIntToa(unldrs_.empty() ? 0 : unldrs_.front().iGetEstimatedBytes())
+            << std::endl;
+    }
     /*
      * @param[in] iWayToNext:
      * - iForward:  drop indexes, disable triggers and constraints.
@@ -157,6 +198,7 @@ public:
                 ({"SYS","DBA_INDEXES","SELECT"})
             ;
         }
+        vSettleScn();
         oCopyDd_.vRefresGetDataRepo(oOwners_);
     }
     ~cUnloadImpl()
@@ -174,6 +216,7 @@ public:
         *st_make_sh_ << boost::format("test -f %s && %s /nolog @%s")
             % sDisableDeps.string() % exec_plus_.string() % sDisableDeps.stem().string() << std::endl;
         vSubmitUnloadSchedule(oTableList);
+        vOrderByLongestFirst();
         // All other threads are joined main thread here.
         ps::lib::vSynchronize(iConcurrency_, unldrs_, &ps::lib::sql::cFetchable::vExecuteAndFetch);
         for (const auto& tbl : oTableList)
@@ -445,7 +488,8 @@ void cUnloadImpl::vGenerateScripts()
      * - This thread blocks until all other threads have joined this thread.
      * - Elements of oQueue_ are consumed and released.
      */
-    ps::lib::vSynchronize(iConcurrency_, oQueue_, &ps::lib::sql::cFetchable::vExecuteAndFetch);
+    ps::lib::vSynchronize(iConcurrency_, oQueue_, &ps::lib::sql::cFetchable::vExecuteAndFetch
+        , ps::lib::cScheduler::tPriority::iHigh);
 
     /*
      * Generating scripts for management.
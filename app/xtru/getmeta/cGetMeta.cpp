@@ -426,7 +426,8 @@ void cGetMetaImpl::vRun()
      * - This thread blocks until all other threads have joined this thread.
      * - Elements of oQueue_ are consumed and released.
      */
-    ps::lib::vSynchronize(iConcurrency_, oQueue_, &ps::lib::sql::cFetchable::vExecuteAndFetch);
+    ps::lib::vSynchronize(iConcurrency_, oQueue_, &ps::lib::sql::cFetchable::vExecuteAndFetch
+        , ps::lib::cScheduler::tPriority::iHigh);
 
     /*
      * Printing script for the schema definition.
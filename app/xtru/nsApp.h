@@ -51,6 +51,7 @@ struct tTabName
     int32_t iDataFmt;
     int32_t iNumLongs;
     int32_t iNumLobs;
+    int64_t iNumBytes; ///< Estimated bytes of the table, NUM_MBYTES of ALL_TABLES in bytes, at least 1 MiB.
     tTabName(
         const char* o
         , const char* t
@@ -58,12 +59,14 @@ struct tTabName
         , int32_t d
         , int32_t l
         , int32_t b
+        , int64_t n = 0
     ) : sOwner(o)
         , sTable(t)
         , sIotType(i)
         , iDataFmt(d)
         , iNumLongs(l)
         , iNumLobs(b)
+        , iNumBytes(n)
     {}
     /**
      * sGetConcatenatedName() returns "<owner_name>"."<table_name>"
@@ -31,6 +31,7 @@
 #define DEGREE_LEN                         (7+1)
 #define INSTANCES_LEN                      (7+1)
 #define GENERATED_LEN                      (1+1)
+#define KEY_LITERAL_LEN             (2*4000+48+1) ///< Literal of a key, quoted VARCHAR2(4000) or a conversion function.
 
 #define  MINIMUM_COLUMN_LENGTH               32  ///< Column name width (meta.sql)
 
@@ -56,6 +57,7 @@
 #include <copydd/cAllTabPartitions.h>
 #include <copydd/cAllPartTables.h>
 #include <copydd/cRowidRanges.h>
+#include <copydd/cKeyRanges.h>
 #include <copydd/cReposRefresher.h>
 #include <copydd/cEffectiveCons.h>
 #include <copydd/cReferenceGraphTab.h>
@@ -72,6 +74,7 @@
 #include <getdata/cQuery.h>
 #include <getdata/cPartitionedByScheme.h>
 #include <getdata/cPartitionedByRowid.h>
+#include <getdata/cPartitionedByKey.h>
 
 #include <getmeta/cNumObjs.h>
 #include <getmeta/cDescriber.h>
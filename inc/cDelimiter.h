@@ -88,24 +88,50 @@ public:
     int32_t iGetVarDigit() const { return iVarDigit_; }
     bool iGetExplicit() const { return iExplicit_; }
     bool iDoesEmbedColumnNames() const { return iEmbedColumnNames_; }
+    /// @brief A string put in front of an enclosed field.
+    const std::string& sGetOpenEnclosure(const tType& iType) const { return sGetEnclosure1(iType); }
+    /// @brief A string put behind an enclosed field.
+    const std::string& sGetCloseEnclosure(const tType& iType) const
+    {
+        return iGetExplicit() ? sGetEnclosure2(iType) : sGetEnclosure1(iType);
+    }
     std::string sGetClauseEncForCtrl() const;
     std::string sGetLengthString(const std::string& body) const;
-    void vEnCls(std::string& dest, const std::string& data, const ps::lib::sql::ind_t& ind, const bool& iSep) const
+    /**
+     * @brief
+     *   Appends an enclosed field to dest.
+     * @tparam D
+     *   std::string or ps::lib::cSlab.
+     */
+    template<class D>
+    void vEnCls(D& dest, const std::string& data, const ps::lib::sql::ind_t& ind, const bool& iSep) const
+    {
+        vEnCls(dest, data.data(), data.size(), ind, iSep);
+    }
+    template<class D>
+    void vEnCls(D& dest, const char* data, const uint32_t len, const ps::lib::sql::ind_t& ind, const bool& iSep) const
     {
-        dest += sGetEnclosure1(iData);
-        if (ind == ps::lib::sql::ind_t::VAL_IS_NOTNULL) dest += data;
-        dest += iGetExplicit() ? sGetEnclosure2(iData) : sGetEnclosure1(iData);
+        dest += sGetOpenEnclosure(iData);
+        if (ind == ps::lib::sql::ind_t::VAL_IS_NOTNULL) dest.append(data, len);
+        dest += sGetCloseEnclosure(iData);
         if (iSep) dest += sGetColSeparator(iData);
     }
-    template<typename U>
-    void vUnCls(std::string& dest, const U& data, const ps::lib::sql::ind_t& ind, const bool& iSep) const
+    /**
+     * @brief
+     *   Appends a field which is not enclosed to dest.
+     * @tparam D
+     *   std::string or ps::lib::cSlab.
+     */
+    template<class D, typename U>
+    void vUnCls(D& dest, const U& data, const ps::lib::sql::ind_t& ind, const bool& iSep) const
     {
         if (ind == ps::lib::sql::ind_t::VAL_IS_NOTNULL) dest += boost::lexical_cast<std::string>(data);
         if (iSep) dest += sGetColSeparator(iData);
     }
-    void vUnCls(std::string& dest, const char* data, const uint32_t len, const ps::lib::sql::ind_t& ind, const bool& iSep) const
+    template<class D>
+    void vUnCls(D& dest, const char* data, const uint32_t len, const ps::lib::sql::ind_t& ind, const bool& iSep) const
     {
-        if (ind == ps::lib::sql::ind_t::VAL_IS_NOTNULL) dest.append(data, data + len);
+        if (ind == ps::lib::sql::ind_t::VAL_IS_NOTNULL) dest.append(data, len);
         if (iSep) dest += sGetColSeparator(iData);
     }
 };
@@ -0,0 +1,68 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+namespace ps
+{
+
+namespace lib
+{
+
+/**
+ * @class cFloatFormatter
+ * @brief
+ * - Formats binary floating-point values to the shortest decimal string
+ *   which is read back to the same value (round-trip).
+ * - The digits are generated by the Grisu2 algorithm with 64-bit integers only,
+ *   so neither snprintf nor the locale is involved.
+ * - The result is accepted as DECIMAL EXTERNAL by SQL*Loader.
+ *   e.g.) "0.1", "-123", "1.5E+20", "2.5E-07", "NAN", "INF", "-INF"
+ * @note
+ *   Grisu2 always round-trips, and gives the shortest digits
+ *   for the vast majority of values. For the rest, one more digit may be printed.
+ */
+class cFloatFormatter
+{
+public:
+    /**
+     * @param [in] d
+     *   A value to be formatted.
+     * @param [out] szBuffer
+     *   At least 25 bytes. It is not terminated by null.
+     * @param [in] iFixedDigits
+     *   The fixed-point notation is used while the decimal exponent
+     *   is between -4 and iFixedDigits - 1, as "%G" does.
+     * @return the length of the string.
+     */
+    static size_t iFormat(const double& d, char* szBuffer, const int32_t& iFixedDigits);
+    /**
+     * @brief
+     *   Same as above, but the shortest digits are decided
+     *   by the precision of the float.
+     */
+    static size_t iFormat(const float& f, char* szBuffer, const int32_t& iFixedDigits);
+};
+
+} // ps::lib
+
+} // ps
+
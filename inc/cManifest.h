@@ -0,0 +1,140 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+namespace ps
+{
+
+namespace lib
+{
+
+/**
+ * @class cManifest
+ * @brief
+ * - A run manifest (rerunpoint) which records the state of each unload task,
+ *   so that an interrupted run can be restarted without the tasks completed.
+ * - One line per task, separated by tabs:
+ * @code
+   STATUS  KEY  FILE  ROWS  BYTES  CRC32  SCN  FILEBYTES
+ * @endcode
+ *   STATUS is either STARTED or DONE. KEY identifies the task by the table
+ *   (or the query) and the partition or the range. FILE lists the pieces
+ *   separated by @ref szPieceSep when the data file is rolled by filesize.
+ *   SCN is the one which the rows of the task have been unloaded up to,
+ *   and it is the baseline of the next incremental run.
+ *   BYTES and CRC32 are of the data written, and FILEBYTES is the size of
+ *   the pieces on the disk, which is smaller when the data is compressed.
+ *   The SCN of a consistent unload is recorded in the first line "#SCN <n>",
+ *   so that the restarted run reads the same snapshot.
+ * - The whole file is rewritten into a temporary file and renamed
+ *   each time a task starts or finishes, so that it is never seen half-written.
+ *
+ * It is implemented as a singleton, and thread-safe.
+ * It does nothing until vOpen is called with a file name.
+ */
+class cManifest
+    : public boost::serialization::singleton< cManifest >
+{
+    friend class boost::serialization::singleton< cManifest >;
+public:
+    static const char szPieceSep[];         ///< Separates the pieces of a data file in FILE.
+    /**
+     * @struct tEntry
+     */
+    struct tEntry
+    {
+        bool iDone_;
+        std::string sFile_;
+        int64_t iNumRows_;
+        int64_t iNumBytes_;
+        uint32_t iCrc32_;
+        int64_t iScn_;      ///< 0 if the task has never been unloaded as of any SCN.
+        int64_t iFileBytes_; ///< Bytes of the pieces on the disk, measured by vFinish.
+    };
+private:
+    ps::lib::cTracer& trc_;
+    std::mutex mtx_;                        ///< to protect following members.
+    boost::filesystem::path sPath_;         ///< Empty if disabled.
+    std::map<std::string, tEntry> oEntries_;
+    /// @brief Entries DONE in the previous run, which are skipped.
+    std::map<std::string, tEntry> oCompleted_;
+    /// @brief SCN of each task in the previous run, which an incremental run starts from.
+    std::map<std::string, int64_t> oBaseline_;
+    int64_t iScn_;                          ///< SCN of the snapshot, 0 if not consistent.
+    cManifest();
+    ~cManifest()
+    {}
+    /**
+     * @brief
+     *   Writes all entries into the temporary file and renames it to @ref sPath_.
+     * @note mtx_ must be locked.
+     */
+    void vSave();
+public:
+    /**
+     * @brief
+     * @param[in] sPath
+     *   Name of the manifest. An empty path disables it.
+     * @param[in] iRestart
+     * - true: reads the manifest of the previous run. The tasks DONE are kept and
+     *   skipped if their files are intact. The files of the other tasks are deleted.
+     *   When iIncremental is also true, a task DONE as of an SCN other than "#SCN"
+     *   was carried from an older run, and it is not skipped.
+     * - false: the manifest is started from scratch.
+     * @param[in] iIncremental
+     *   true: reads the SCN of each task from the manifest of the previous run
+     *   as the baseline of @ref iGetBaseScn.
+     * @note The rows read are carried forward until vStart replaces each of them,
+     *   so that the manifest rewritten here still has the tasks which are never reached.
+     */
+    void vOpen(const boost::filesystem::path& sPath, const bool& iRestart, const bool& iIncremental);
+    bool iEnabled() const { return ! sPath_.empty(); }
+    /**
+     * @return true if the task was completed by the previous run.
+     * @param[out] oEntry
+     *   The record of the task completed.
+     */
+    bool iIsCompleted(const std::string& sKey, tEntry& oEntry);
+    /**
+     * @brief
+     *   Records that the task has started to write sFile.
+     */
+    void vStart(const std::string& sKey, const std::string& sFile);
+    /**
+     * @brief
+     *   Records that the task has finished. The size of its closed pieces is measured here.
+     */
+    void vFinish(const std::string& sKey, const tEntry& oEntry);
+    /**
+     * @brief
+     *   Records the SCN which all tasks read as of.
+     */
+    void vSetScn(const int64_t& iScn);
+    /// @return SCN recorded, which is read from the previous run when restarted.
+    int64_t iGetScn();
+    /// @return SCN which the task was unloaded up to by the previous run, 0 if none.
+    int64_t iGetBaseScn(const std::string& sKey);
+};
+
+} // ps::lib
+
+} // ps
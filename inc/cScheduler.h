@@ -0,0 +1,166 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+namespace ps
+{
+
+namespace lib
+{
+
+/**
+ * @class cScheduler
+ * @brief
+ * - A process-wide pool of persistent worker threads.
+ *   Every asynchronous task (unloading, getmeta, copydd and
+ *   the sub-statements of an unloader) is run on it.
+ * - The number of workers is the hard upper limit of concurrency,
+ *   because a nested task never creates a thread.
+ * - Tasks submitted from outside the pool are queued globally in the order
+ *   of priority (first come first served within the same priority).
+ *   Tasks submitted by a worker (nested tasks) are pushed to its own deque,
+ *   and idle workers steal them from the opposite end.
+ * - A worker waiting for its nested tasks runs them by itself,
+ *   so that the pool never deadlocks even if all workers are waiting.
+ *   It runs only the tasks of the group it waits for, so that the priority
+ *   is never inverted by a task of another group.
+ * - Busy and idle time of each worker is accumulated for the trace.
+ *
+ * @par Example way to be used:
+ * @code
+    auto& oSched = ps::lib::cScheduler::get_mutable_instance();
+    oSched.vEnsureWorkers(4);
+    ps::lib::cScheduler::cGroup oGroup;
+    oSched.vSubmit(oGroup, []{ ... });
+    oGroup.vWait(); // The first exception thrown by the tasks is re-thrown.
+   @endcode
+ */
+class cScheduler
+    : public boost::serialization::singleton< cScheduler >
+{
+    friend class boost::serialization::singleton< cScheduler >;
+public:
+    typedef std::function<void()> tJob;
+    enum class tPriority : int32_t { iLow, iNormal, iHigh };
+    struct tWorker;
+    /**
+     * @class cGroup
+     * @brief
+     *   Tasks which are waited for together.
+     */
+    class cGroup
+    {
+        friend class cScheduler;
+    private:
+        std::mutex mtx_;            ///< to protect following members.
+        std::condition_variable evt_;
+        int32_t iInFlight_;         ///< Number of tasks submitted but not finished.
+        std::exception_ptr ep_;     ///< The earliest exception thrown by the tasks.
+        cGroup(const cGroup&) =delete;
+        cGroup& operator=(const cGroup&) =delete;
+    public:
+        cGroup();
+        /**
+         * @brief
+         *   Waits for all tasks, but the exception is not thrown.
+         */
+        ~cGroup();
+        /**
+         * @brief
+         * - Blocks until the number of tasks in flight is iMaxInFlight or less.
+         * - On a worker, the tasks of this group are run meanwhile,
+         *   taken from its own deque or stolen from the others.
+         */
+        void vWaitUntil(const int32_t& iMaxInFlight);
+        /**
+         * @brief
+         *   Waits for all tasks, and re-throws the earliest exception thrown by them.
+         */
+        void vWait();
+        bool iFailed();
+    };
+private:
+    /**
+     * @struct tTask
+     */
+    struct tTask
+    {
+        tJob fJob_;
+        cGroup* oGroup_;
+        tPriority iPriority_;
+        uint64_t iSeq_;             ///< Order of submission.
+        bool operator<(const tTask& rhs) const
+        {
+            // std::priority_queue pops the greatest one.
+            return iPriority_ != rhs.iPriority_
+                ? iPriority_ < rhs.iPriority_
+                : iSeq_ > rhs.iSeq_;
+        }
+    };
+    ps::lib::cTracer& trc_;
+    std::mutex mtx_;                ///< to protect following members until iStop_.
+    std::condition_variable evt_;   ///< Notified when a task is submitted.
+    std::priority_queue<tTask> oGlobal_;
+    std::vector<std::unique_ptr<tWorker>> oWorkers_;
+    uint64_t iSeq_;
+    bool iStop_;
+    std::atomic<int32_t> iPending_; ///< Number of queued tasks, in any queue.
+    cScheduler();   // will call by ctor of "singleton_wrapper<cScheduler>".
+    ~cScheduler();
+    /// @brief Body of the worker thread.
+    void vRun(tWorker* oSelf);
+    /**
+     * @brief
+     *   Takes a task from the own deque, the global queue, or the others' deques in this order.
+     * @param [in] oOnly
+     *   If it is given, only a task of this group is taken, and the global queue is skipped.
+     */
+    bool iTake(tWorker* oSelf, const cGroup* oOnly, tTask& oTask);
+    /// @brief Runs oTask and notifies its group.
+    static void vExecute(tTask& oTask);
+public:
+    /**
+     * @brief
+     *   Starts workers until the number of them reaches iNumWorkers.
+     *   Workers are never decreased.
+     */
+    void vEnsureWorkers(const int32_t& iNumWorkers);
+    int32_t iGetNumWorkers();
+    /**
+     * @brief
+     *   Submits fJob as a task of oGroup.
+     * @param [in] iPriority
+     *   It is ignored for a nested task, which is run before the others.
+     */
+    void vSubmit(cGroup& oGroup, tJob fJob, const tPriority& iPriority = tPriority::iNormal);
+    /**
+     * @brief
+     * - Writes the number of tasks, busy and idle time of each worker to the trace file.
+     * - The values are accumulated since the process started.
+     * - Nothing is written when it is called by a worker.
+     */
+    void vTraceStats();
+};
+
+} // ps::lib
+
+} // ps
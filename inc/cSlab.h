@@ -0,0 +1,141 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+namespace ps
+{
+
+namespace lib
+{
+
+/**
+ * @class cSlab
+ * @brief
+ * - A contiguous byte buffer which is reused over and over again.
+ * - One bulk of rows is serialized into here, and is handed
+ *   to the ostream by only one write operation.
+ * - The capacity grows geometrically and never shrinks until
+ *   the instance is destructed. Therefore, after a few bulks,
+ *   no heap operation occurs any more.
+ * - Its interface partially imitates std::string so that
+ *   ps::lib::cDelimiter can append fields to both.
+ * @note
+ *   It is not thread-safe. Each thread must own its instance.
+ */
+class cSlab
+{
+private:
+    std::unique_ptr<char[]> buf_;
+    size_t iSize_;     ///< Number of bytes in use.
+    size_t iCapacity_; ///< Number of bytes allocated.
+    /**
+     * @brief
+     *   Reallocates the buffer to store at least iRequired bytes.
+     */
+    void vGrow(const size_t& iRequired);
+public:
+    /**
+     * @param [in] iCapacity
+     *   Number of bytes to be allocated in advance.
+     */
+    explicit cSlab(const size_t& iCapacity =0);
+    cSlab(cSlab&& rhs);
+    cSlab(const cSlab&) =delete;
+    cSlab& operator=(const cSlab&) =delete;
+    /**
+     * @brief
+     *   Exchanges the buffers (and their contents) with rhs.
+     */
+    void swap(cSlab& rhs)
+    {
+        std::swap(buf_, rhs.buf_);
+        std::swap(iSize_, rhs.iSize_);
+        std::swap(iCapacity_, rhs.iCapacity_);
+    }
+    /**
+     * @brief
+     *   Extends the used area by n bytes and returns its beginning.
+     * @note
+     *   The pointer returned is invalidated by the next extension.
+     *   Use the offset (size() before calling) to refer it later.
+     */
+    char* szReserve(const size_t& n)
+    {
+        if (iSize_ + n > iCapacity_)
+        {
+            vGrow(iSize_ + n);
+        }
+        char* p = buf_.get() + iSize_;
+        iSize_ += n;
+        return p;
+    }
+    void append(const char* data, const size_t& len)
+    {
+        ::memcpy(szReserve(len), data, len);
+    }
+    void append(const char* first, const char* last)
+    {
+        append(first, static_cast<size_t>(last - first));
+    }
+    cSlab& operator+=(const std::string& s)
+    {
+        append(s.data(), s.size());
+        return *this;
+    }
+    cSlab& operator+=(const char& c)
+    {
+        *szReserve(1) = c;
+        return *this;
+    }
+    /**
+     * @brief
+     *   Shortens the used area to iSize bytes.
+     */
+    void vTruncate(const size_t& iSize)
+    {
+        BOOST_ASSERT(iSize <= iSize_);
+        iSize_ = iSize;
+    }
+    /**
+     * @brief
+     *   Empties the used area, but keeps the allocated memory.
+     */
+    void vClear() { iSize_ = 0; }
+    /**
+     * @brief
+     * - Overwrites iWidth bytes from iOffset with zero-filled decimal of iValue.
+     * - It is used to back-patch the length field reserved
+     *   by szReserve before the body was appended.
+     * - If iValue needs more digits than iWidth, following bytes
+     *   are shifted backward as std::setw does.
+     */
+    void vPatchDecimal(const size_t& iOffset, const int32_t& iWidth, size_t iValue);
+    const char* data() const { return buf_.get(); }
+    char* data() { return buf_.get(); }
+    size_t size() const { return iSize_; }
+    size_t iGetCapacity() const { return iCapacity_; }
+};
+
+} // ps::lib
+
+} // ps
+
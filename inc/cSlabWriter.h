@@ -0,0 +1,183 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+namespace ps
+{
+
+namespace lib
+{
+
+/**
+ * @class cSlabWriter
+ * @brief
+ * - A writer stage dedicated to one output stream.
+ * - Formatting threads (producers) hand over filled ps::lib::cSlab
+ *   through a bounded queue, and a single writer thread (consumer)
+ *   drains it to the stream in the order of arrival.
+ * - Producers never wait for the I/O itself. They only wait
+ *   when the queue is full, and that time is accumulated as stall time.
+ * - Emptied slabs are recycled to the producers, so the number
+ *   of slabs (and memory) per stream is bounded.
+ * - If vSetRolling is called, the stream is switched to the next one
+ *   at the first row boundary after the piece reached the given size.
+ *
+ * @par Example way to be used:
+ * @code
+    ps::lib::cSlabWriter oWriter(os, 8, tag);
+    ps::lib::cSlabWriter::tSlabPtr oSlab(new ps::lib::cSlab);
+    .... // fill up oSlab.
+    oWriter.vPush(oSlab); // oSlab is replaced with an empty one.
+    oWriter.vClose();
+   @endcode
+ */
+class cSlabWriter
+{
+public:
+    typedef std::unique_ptr<ps::lib::cSlab> tSlabPtr;
+    /// @brief Closes the current stream and returns the next one. Called by the writer thread.
+    typedef std::function<std::ostream&()> tRoller;
+    /// @brief Called by the writer thread after each write, with its bytes and microseconds.
+    typedef std::function<void(const int64_t&, const int64_t&)> tMeter;
+private:
+    ps::lib::cTracer& trc_;
+    std::ostream* os_;
+    const std::string tag_;
+    const size_t iCapacity_;           ///< Upper limit of the queue depth.
+    std::mutex mtx_;                   ///< to protect following members until thr_.
+    std::condition_variable evtFilled_;
+    std::condition_variable evtEmptied_;
+    /// @brief Slabs waiting to be written, and whether each ends at a row boundary.
+    std::deque<std::pair<tSlabPtr, bool>> oFilled_;
+    std::stack<tSlabPtr> oEmptied_;    ///< Slabs already written, and to be recycled.
+    bool iClosed_;
+    std::exception_ptr ep_;            ///< An exception occured in the writer thread.
+    std::thread::id oOwner_;           ///< A producer spilling a row, which others must wait for.
+    size_t iMaxDepth_;                 ///< Peak of the queue depth.
+    int64_t iBytesInFlight_;           ///< Bytes pushed but not written yet.
+    int64_t iMaxBytesInFlight_;
+    int64_t iNumStalls_;               ///< Number of times producers waited.
+    int64_t iStallMicroSecs_;          ///< Total time producers waited.
+    int64_t iBytesWritten_;
+    int64_t iWriteMicroSecs_;          ///< Total time spent in the write operation.
+    int64_t iNumSpills_;               ///< Number of partial slabs handed over by vSpill.
+    boost::crc_32_type oCrc_;          ///< CRC-32 of the bytes written, for the rerunpoint.
+    int64_t iPieceBytes_;              ///< Size to roll the stream at, 0 if it is never rolled.
+    int64_t iBytesInPiece_;            ///< Bytes written to the current stream.
+    bool iRollPending_;                ///< The current stream is full at a row boundary.
+    tRoller oRoller_;
+    tMeter oMeter_;
+    std::thread thr_;
+    /**
+     * @brief
+     *   Body of the writer thread.
+     */
+    void vRun();
+    /**
+     * @brief
+     *   Common part of vPush and vSpill.
+     * @param [in] iKeepOwnership
+     *   true makes the calling thread the owner of the stream,
+     *   false releases it if the calling thread owns.
+     */
+    void vEnqueue(tSlabPtr& oSlab, const bool& iKeepOwnership);
+    cSlabWriter(const cSlabWriter&) =delete;
+    cSlabWriter& operator=(const cSlabWriter&) =delete;
+public:
+    /**
+     * @param [in,out] os
+     *   The stream to be written. It must outlive this instance.
+     * @param [in] iCapacity
+     *   Upper limit of the number of slabs waiting to be written.
+     * @param [in] tag
+     *   An identifier for the output of diagnosis.
+     */
+    cSlabWriter(std::ostream& os, const size_t& iCapacity, const std::string& tag);
+    /**
+     * @brief
+     *   Calls vClose, but any exceptions are not thrown.
+     */
+    ~cSlabWriter();
+    /**
+     * @brief
+     * - Enqueues oSlab to be written, and replaces it with an empty slab.
+     * - Blocks while the queue is full.
+     * - Thread-safe. Called from the formatting threads.
+     *
+     * @param [in,out] oSlab
+     *   A filled slab. An empty slab is returned instead.
+     * @exception std::runtime_error
+     *   The writer thread has already failed.
+     */
+    void vPush(tSlabPtr& oSlab);
+    /**
+     * @brief
+     * - Enqueues the contents of a slab which is still being filled,
+     *   e.g. in the middle of a long value, and empties it.
+     * - Since the rest of the row has not been written yet, the calling
+     *   thread owns the stream until its next vPush (or vRelease);
+     *   other producers wait for that.
+     * - Thread-safe. Called from the formatting threads.
+     *
+     * @param [in,out] oSlab
+     *   A partially filled slab. It is emptied.
+     * @exception std::runtime_error
+     *   The writer thread has already failed.
+     */
+    void vSpill(ps::lib::cSlab& oSlab);
+    /**
+     * @brief
+     *   Gives up the ownership taken by vSpill without pushing,
+     *   e.g. when the calling thread failed in the middle of a row.
+     */
+    void vRelease();
+    /**
+     * @brief
+     * - Waits for all queued slabs to be written, and stops the writer thread.
+     * - The statistics are reported to the trace file.
+     * - If the writer thread failed, its exception is re-thrown.
+     */
+    void vClose();
+    /**
+     * @brief
+     *   Enables rolling the stream. It must be called before the first vPush.
+     * @param [in] iPieceBytes
+     *   Size of a piece. The piece may exceed it by the last slab, because
+     *   the stream is switched only at a row boundary.
+     * @param [in] oRoller
+     *   Called by the writer thread to switch the stream, only when more bytes come.
+     */
+    void vSetRolling(const int64_t& iPieceBytes, tRoller oRoller);
+    /**
+     * @brief
+     *   Reports each write to oMeter. It must be called before the first vPush.
+     */
+    void vSetMeter(tMeter oMeter);
+    int64_t iGetBytesWritten() const { return iBytesWritten_; }
+    /// @return CRC-32 of the bytes written, valid after vClose.
+    uint32_t iGetChecksum() const { return oCrc_.checksum(); }
+};
+
+} // ps::lib
+
+} // ps
+
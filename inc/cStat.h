@@ -35,6 +35,7 @@ namespace lib
  *
  * -# Erapsed time. 
  * -# Total output bytes.
+ * -# Total estimated bytes of the tasks, which is used to compute the ETA.
  *
  * It is implemented as a singleton.<br/>
  * Accessing to member variables for counting is atomically kept.<br/>
@@ -46,6 +47,11 @@ class cStat
     friend class boost::serialization::singleton< cStat >;
 private:
     std::atomic<int64_t> iOutputBytes_;  ///< @brief Total output bytes.
+    std::atomic<int64_t> iEstimatedBytes_; ///< @brief Total estimated bytes of the tasks.
+    /// @brief Estimated and actual bytes of the finished tasks,
+    ///   their ratio corrects the estimation of the rest.
+    std::atomic<int64_t> iSettledEstimate_;
+    std::atomic<int64_t> iSettledActual_;
     /// @brief holds a time at instanciation.
     const boost::posix_time::ptime time_at_started_;
     /**
@@ -77,6 +83,23 @@ public:
      *   The unit is milli-seconds.
      */
     int32_t iDurationMilliSeconds() const;
+    /**
+     * @brief
+     * @param[in] iEstimatedBytes
+     *   Estimated output bytes of a task which will be run.
+     */
+    void vAddEstimatedBytes(const int64_t& iEstimatedBytes);
+    /**
+     * @brief
+     *   Tells how many bytes were output actually by a task estimated as iEstimatedBytes.
+     */
+    void vSettleEstimate(const int64_t& iEstimatedBytes, const int64_t& iActualBytes);
+    /**
+     * @brief
+     * @return " ETA hh:mm:ss (nn%)" computed from output bytes against the estimated total.<br/>
+     *   An empty string if no task was estimated.
+     */
+    std::string sGetEta() const;
     /**
      * @brief
      */
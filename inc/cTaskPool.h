@@ -0,0 +1,108 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+namespace ps
+{
+
+namespace lib
+{
+
+/**
+ * @class cTaskPool
+ * @brief
+ * - A small number of threads which run the submitted tasks in FIFO order.
+ * - It is separated from ps::lib::cScheduler for the work which a writer
+ *   of a stream waits for, because the workers of cScheduler may be
+ *   the ones waiting for that writer.
+ * - An exception thrown by a task is stored into its future.
+ *
+ * @tparam R
+ *   Type of the result of a task.
+ */
+template<class R>
+class cTaskPool
+{
+public:
+    typedef std::function<R()> tTask;
+    explicit cTaskPool(const int32_t& iNumThreads)
+        : iStopped_(false)
+    {
+        for (auto i = 0; i < iNumThreads; ++i)
+        {
+            oThreads_.emplace_back(&cTaskPool::vRun, this);
+        }
+    }
+    /// Runs the tasks remaining in the queue, then joins all threads.
+    ~cTaskPool()
+    {
+        {
+            std::lock_guard<std::mutex> lk(mtx_);
+            iStopped_ = true;
+        }
+        evtQueued_.notify_all();
+        for (auto& thr: oThreads_)
+        {
+            thr.join();
+        }
+    }
+    std::future<R> oSubmit(tTask oTask)
+    {
+        std::packaged_task<R()> oPackaged(oTask);
+        auto oFuture = oPackaged.get_future();
+        {
+            std::lock_guard<std::mutex> lk(mtx_);
+            oQueue_.push_back(std::move(oPackaged));
+        }
+        evtQueued_.notify_one();
+        return oFuture;
+    }
+    size_t iGetNumThreads() const { return oThreads_.size(); }
+private:
+    std::mutex mtx_;
+    std::condition_variable evtQueued_;
+    std::deque<std::packaged_task<R()>> oQueue_;
+    bool iStopped_;
+    std::vector<std::thread> oThreads_;
+    void vRun()
+    {
+        for (;;)
+        {
+            std::packaged_task<R()> oTask;
+            {
+                std::unique_lock<std::mutex> lk(mtx_);
+                evtQueued_.wait(lk, [this]{ return ! oQueue_.empty() || iStopped_; });
+                if (oQueue_.empty())
+                {
+                    break;
+                }
+                oTask = std::move(oQueue_.front());
+                oQueue_.pop_front();
+            }
+            oTask();
+        }
+    }
+};
+
+} // ps::lib
+
+} // ps
@@ -0,0 +1,77 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+namespace ps
+{
+namespace lib
+{
+namespace nsStreamLocator
+{
+
+class cCompressedFileImpl;
+
+/**
+ * @class cCompressedFile
+ * @brief
+ * - A file written through a compressing filter, in place of cFileSystem.
+ * - The bytes are cut into frames of the given size. Each frame is compressed
+ *   independently by a small pool of threads shared by all instances,
+ *   and the frames are written to the file in order.
+ * - Concatenated frames make a valid stream for "gzip -d", "zstd -d" and "lz4 -d".
+ * - flush() compresses the partial frame, and writes all frames to the file.
+ *   A failure sets the badbit, so that the caller must check the stream after it.
+ * - The compression ratio is reported to the trace file when it is closed.
+ */
+class cCompressedFile
+    : public std::ostream
+{
+public:
+    typedef enum _tCodec {iGzip, iZstd, iLz4} tCodec;
+    /**
+     * @brief
+     *
+     * @param[in] sName
+     *   Name of the file to be created.
+     * @param[in] iCodec
+     * @param[in] iLevel
+     *   Compression level of the codec. 0 means the default level of the codec.
+     * @param[in] iFrameBytes
+     *   Number of bytes of uncompressed data in a frame.
+     * @exception
+     *   Failed to create the file.
+     */
+    cCompressedFile(
+        const std::string& sName
+        , const tCodec& iCodec
+        , const int32_t& iLevel
+        , const int64_t& iFrameBytes
+    );
+private:
+    std::unique_ptr<cCompressedFileImpl, void(*)(cCompressedFileImpl *)> oImpl_;
+};
+
+} // ps::lib::nsStreamLocator
+
+} // ps::lib
+
+} // ps
@@ -0,0 +1,78 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+namespace ps
+{
+namespace lib
+{
+namespace nsStreamLocator
+{
+
+class cDirectFileImpl;
+
+/**
+ * @class cDirectFile
+ * @brief
+ * - A file written with O_DIRECT, bypassing the page cache, in place of cFileSystem.
+ * - The bytes are gathered into aligned buffers, and the full buffers are
+ *   written asynchronously, keeping up to the given number of writes in flight.
+ *   io_uring is used when it is available, otherwise a small pool of threads
+ *   shared by all instances calls pwrite.
+ * - The unaligned tail is padded to the alignment at close,
+ *   and the file is truncated to the number of bytes actually written.
+ * - If the file system refuses O_DIRECT, the file is written through the page cache
+ *   in the same way.
+ * - flush() waits for the writes in flight and writes the partially filled buffer,
+ *   which is written again at the same offset when it gets full.
+ *   A failed write sets the badbit, so that the caller must check the stream after it.
+ */
+class cDirectFile
+    : public std::ostream
+{
+public:
+    /**
+     * @brief
+     *
+     * @param[in] sName
+     *   Name of the file to be created.
+     * @param[in] iBufferBytes
+     *   Bytes of a buffer, rounded up to the alignment of O_DIRECT.
+     * @param[in] iQueueDepth
+     *   Number of buffers, which is the number of writes in flight at most.
+     * @exception
+     *   Failed to create the file.
+     */
+    cDirectFile(
+        const std::string& sName
+        , const int64_t& iBufferBytes
+        , const int32_t& iQueueDepth
+    );
+private:
+    std::unique_ptr<cDirectFileImpl, void(*)(cDirectFileImpl *)> oImpl_;
+};
+
+} // ps::lib::nsStreamLocator
+
+} // ps::lib
+
+} // ps
@@ -33,6 +33,13 @@ class cFileSystemImpl;
 /**
  * @class cFileSystem
  * @brief
+ * - A file written through the page cache.
+ * - When @ref iPreallocate_ is true, the expected bytes are preallocated
+ *   by fallocate, and the unused part is trimmed when it is closed.
+ * - When @ref iWritebackWindow_ is not 0, the writeback of each window is started
+ *   as soon as it is filled, and the previous window is waited for and dropped
+ *   from the page cache, so that the dirty pages are kept within two windows.
+ *   The time waiting for the writeback is reported to the trace file when it is closed.
  */
 class cFileSystem
     : public std::ostream
@@ -42,11 +49,13 @@ public:
      * @brief
      * 
      * @param[in] sName
-     *   Name of the pipe to be created.
+     *   Name of the file to be created.
+     * @param[in] iExpectedBytes
+     *   Bytes expected to be written, 0 if it is unknown.
      * @exception
-     *   Failed to create named pipe.
+     *   Failed to create the file.
      */
-    explicit cFileSystem(const std::string& sName);
+    explicit cFileSystem(const std::string& sName, const int64_t& iExpectedBytes = 0);
 private:
     std::unique_ptr<cFileSystemImpl, void(*)(cFileSystemImpl *)> oImpl_;
 };
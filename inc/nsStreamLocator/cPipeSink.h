@@ -0,0 +1,72 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+namespace ps
+{
+namespace lib
+{
+namespace nsStreamLocator
+{
+
+/**
+ * @class cPipeSink
+ * @brief
+ * - A sink writing into a pipe, shared by cLocalProcess and cNamedPipe.
+ * - The capacity of the pipe is enlarged to @ref iPipeBytes_ by F_SETPIPE_SZ,
+ *   and the stream buffer is expected to be as large as the capacity,
+ *   so that the pipe is filled by one write.
+ * - The descriptor is made non-blocking, so that the time the writer is blocked
+ *   on a full pipe is measured. It is reported to the trace file when it is closed.
+ * - The descriptor is owned, and closed by close().
+ */
+class cPipeSink
+{
+public:
+    typedef char char_type;
+    struct category
+        : boost::iostreams::sink_tag
+        , boost::iostreams::closable_tag
+    {};
+    /**
+     * @brief
+     * @param[in] fd
+     *   Descriptor of the write end of the pipe.
+     * @param[in] sName
+     *   Name of the pipe for the diagnosis.
+     */
+    cPipeSink(const int& fd, const std::string& sName);
+    std::streamsize write(const char* s, std::streamsize n);
+    void close();
+    /// @return Bytes of the capacity of the pipe, which is also the size of the buffer.
+    std::streamsize iGetCapacity() const;
+private:
+    struct tState;
+    /// @brief boost::iostreams copies the sink.
+    std::shared_ptr<tState> st_;
+};
+
+} // ps::lib::nsStreamLocator
+
+} // ps::lib
+
+} // ps
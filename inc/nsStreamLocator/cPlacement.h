@@ -0,0 +1,140 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+namespace ps
+{
+namespace lib
+{
+namespace nsStreamLocator
+{
+
+/**
+ * @class cPlacement
+ * @brief
+ * - Chooses the directory of each data file among dfile_alt_dirs,
+ *   which the macro {A} of the stream locator is expanded to.
+ * - A directory is eligible if its free space (statvfs), less the bytes
+ *   still expected to be written by the files open in it, keeps the minimum free size.
+ *   Among them, the one which is expected to drain those bytes first
+ *   at its moving average throughput is chosen.
+ * - The bytes written and the time spent in writing them are reported by
+ *   ps::lib::cSlabWriter for each file, so the throughput excludes the time
+ *   the file waited for the rows.
+ * - As a directory is chosen each time a file is opened, a rolled piece
+ *   fails over to another directory when the volume becomes full.
+ *
+ * It is implemented as a singleton, and thread-safe.
+ * It does nothing until vSetDirectories is called with directories.
+ */
+class cPlacement
+    : public boost::serialization::singleton< cPlacement >
+{
+    friend class boost::serialization::singleton< cPlacement >;
+private:
+    /**
+     * @struct tDirectory
+     */
+    struct tDirectory
+    {
+        boost::filesystem::path sPath_;
+        int32_t iNumOpen_;          ///< Files open in the directory.
+        int64_t iPending_;          ///< Bytes expected to be still written by the files open.
+        double dBytesPerSec_;       ///< Moving average, 0 until the first file is released.
+    };
+    /**
+     * @struct tLease
+     */
+    struct tLease
+    {
+        size_t iDirectory_;
+        int64_t iExpected_;         ///< Bytes expected for the file.
+        int64_t iWritten_;
+        int64_t iWriteMicroSecs_;   ///< Time spent in writing iWritten_.
+    };
+    ps::lib::cTracer& trc_;
+    std::mutex mtx_;                        ///< to protect following members.
+    std::vector<tDirectory> oDirectories_;  ///< Empty if disabled.
+    std::map<boost::filesystem::path, tLease> oLeases_;
+    int64_t iMinimumFree_;
+    /// @brief Moving average of the size of a file, which is expected for a file open.
+    double dFileBytes_;
+    cPlacement();
+    ~cPlacement()
+    {}
+public:
+    /**
+     * @brief
+     * @param[in] oDirectories
+     *   Candidates of the directory. An empty vector disables the placement.
+     * @param[in] iMinimumFree
+     *   Bytes to be left free in each volume.
+     * @param[in] iFileBytes
+     *   Bytes expected for a file until the sizes of the files are measured, e.g. filesize.
+     * @exception
+     *   A directory does not exist.
+     */
+    void vSetDirectories(
+        const std::vector<boost::filesystem::path>& oDirectories
+        , const int64_t& iMinimumFree
+        , const int64_t& iFileBytes
+    );
+    bool iEnabled() const { return ! oDirectories_.empty(); }
+    /**
+     * @brief
+     *   Chooses a directory, and counts a file open in it.
+     * @param[in,out] iExpectedBytes
+     *   Bytes expected for the file. 0 is replaced with the average size of a file.
+     * @exception
+     *   No directory has the minimum free space.
+     */
+    boost::filesystem::path sAcquire(int64_t& iExpectedBytes);
+    /**
+     * @brief
+     *   Associates the file created with the directory acquired.
+     * @param[in] iExpectedBytes
+     *   The one given back by sAcquire.
+     */
+    void vAttach(
+        const boost::filesystem::path& sDirectory
+        , const boost::filesystem::path& sFile
+        , const int64_t& iExpectedBytes
+    );
+    /**
+     * @brief
+     *   Accounts bytes written into the file, and the time spent in writing them.
+     *   It does nothing for a file which has not been attached.
+     */
+    void vAddWritten(const boost::filesystem::path& sFile, const int64_t& iBytes, const int64_t& iMicroSecs);
+    /**
+     * @brief
+     *   Measures the file closed, and releases its directory.
+     *   It does nothing for a file which has not been attached.
+     */
+    void vRelease(const boost::filesystem::path& sFile);
+};
+
+} // ps::lib::nsStreamLocator
+
+} // ps::lib
+
+} // ps
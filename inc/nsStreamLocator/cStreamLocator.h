@@ -80,6 +80,23 @@ public:
      * @brief
      */
     virtual const std::string sGetPartitionName() const;
+    /**
+     * @brief
+     * The piece number is expanded by the macro {N}. If the location of
+     * the file scheme has no {N}, it is put before the extension.
+     */
+    virtual void vSetPiece(const int32_t& iPiece);
+    /**
+     * @brief
+     * Bytes expected to be written into the files opened by the following oOpen, 0 if unknown.
+     */
+    virtual void vSetExpectedBytes(const int64_t& iExpectedBytes);
+    /**
+     * @brief
+     * The suffix of a delta is expanded by the macro {S}. If the location of
+     * the file scheme has no {S}, it is put before the extension of the data file.
+     */
+    virtual void vSetDelta(const std::string& sDelta);
 private:
     std::unique_ptr<cStreamLocatorImpl, void (*)(cStreamLocatorImpl *)> oImpl_;
 };
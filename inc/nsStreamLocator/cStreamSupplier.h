@@ -34,6 +34,12 @@ public:
     virtual std::unique_ptr<std::ostream> oOpen(const tExtType&, const std::string& sConcatAlt = "") =0;
     virtual const boost::filesystem::path& oGetsLastOpendFilename() const =0;
     virtual const std::string sGetPartitionName() const =0;
+    /// @brief Selects the piece which the following oOpen is for. 0 is not a piece.
+    virtual void vSetPiece(const int32_t& iPiece) =0;
+    /// @brief Tells the bytes expected for the data file which the following oOpen is for.
+    virtual void vSetExpectedBytes(const int64_t& iExpectedBytes) =0;
+    /// @brief Selects the delta which the following oOpen is for. Empty is a full unload.
+    virtual void vSetDelta(const std::string& sDelta) =0;
     virtual ~cStreamSupplier() =0;
 };
 
@@ -37,6 +37,14 @@ extern std::string sConnectTo_;
 extern tExts oExts_;
 extern tEnvMap oEnvMap_;
 extern bool iSuppressCtrlf_;    ///< false means that the control file is outputted.
+extern int32_t iCompressLevel_;      ///< 0 means the default level of the codec.
+extern int64_t iCompressFrameBytes_; ///< Bytes of a frame compressed independently.
+extern int32_t iCompressThreads_;    ///< Threads compressing the frames.
+extern int64_t iDirectBufferBytes_;  ///< Bytes of a buffer written with O_DIRECT.
+extern int32_t iDirectQueueDepth_;   ///< Writes in flight per file of the direct scheme.
+extern bool iPreallocate_;           ///< true means that the file scheme preallocates the expected bytes.
+extern int64_t iWritebackWindow_;    ///< Bytes of a writeback window of the file scheme, 0 if disabled.
+extern int64_t iPipeBytes_;          ///< Capacity of the pipes of ipc_pipe and named_pipe, 0 keeps the default.
 
 extern const boost::regex regLocationExpr;
 extern const boost::regex regMacroSymbolExpr;
@@ -51,6 +59,23 @@ struct tInitParams
     std::string sOwner;              ///< @brief {I}
     std::string sTableName;          ///< @brief {T}
     std::string sPartitionName;      ///< @brief {P}
+    /**
+     * @brief {N}
+     * Sequence number of the piece of a data file rolled by filesize, from 1.
+     * 0 means that the file is not rolled, or the control file lists all pieces.
+     */
+    int32_t iPiece;
+    /**
+     * @brief
+     * Bytes expected to be written into the file, 0 if it is unknown.
+     * The file scheme preallocates them.
+     */
+    int64_t iExpectedBytes;
+    /**
+     * @brief {S}
+     * Suffix of the data file of a delta unloaded incrementally, empty for a full unload.
+     */
+    std::string sDelta;
 };
 
 /**
@@ -66,7 +91,7 @@ extern const ps::lib::cMap<std::string, tMacroAction> oMacroMap_;
  * A map that associates the construction logic of the stream
  * with the scheme.
  */
-typedef std::function<std::ostream*(const std::string&) > tOstreamGenerator;
+typedef std::function<std::ostream*(const std::string&, const tInitParams&) > tOstreamGenerator;
 extern const ps::lib::cMap<std::string, tOstreamGenerator> oSchemeMap_;
 
 /**
@@ -98,6 +123,61 @@ extern void vInitialize(
 
 extern std::string sGetStreamLocator(const tExtType& iExtType);
 
+/**
+ * @brief
+ * sets parameters of the compressing schemes, gzip, zstd and lz4.
+ * @param [in] iLevel
+ *   Compression level. 0 means the default level of the codec.
+ * @param [in] iFrameBytes
+ *   Bytes of uncompressed data in one frame, which is compressed independently.
+ * @param [in] iNumThreads
+ *   Number of threads compressing the frames. It is effective before the first frame.
+ */
+extern void vSetCompression(
+    const int32_t iLevel
+    , const int64_t iFrameBytes
+    , const int32_t iNumThreads
+);
+
+/**
+ * @brief
+ * sets parameters of the direct scheme, which writes with O_DIRECT asynchronously.
+ * @param [in] iBufferBytes
+ *   Bytes of a buffer. It is rounded up to the alignment of O_DIRECT.
+ * @param [in] iQueueDepth
+ *   Number of writes in flight per file.
+ *   It is also the number of threads calling pwrite when io_uring is not used,
+ *   which is effective before the first write.
+ */
+extern void vSetDirectIo(
+    const int64_t iBufferBytes
+    , const int32_t iQueueDepth
+);
+
+/**
+ * @brief
+ * sets parameters of the file scheme.
+ * @param [in] iPreallocate
+ *   true: the expected bytes of a data file are preallocated by fallocate,
+ *   and the rest is trimmed when it is closed.
+ * @param [in] iWindowBytes
+ *   Each time this many bytes are written, their writeback is started by sync_file_range,
+ *   and the previous window is waited for and dropped from the page cache.
+ *   0 leaves the writeback to the kernel.
+ */
+extern void vSetWriteback(
+    const bool iPreallocate
+    , const int64_t iWindowBytes
+);
+
+/**
+ * @brief
+ * sets the capacity of the pipes of the ipc_pipe and named_pipe schemes.
+ * @param [in] iPipeBytes
+ *   Bytes set by F_SETPIPE_SZ, which is also the size of a write. 0 keeps the default.
+ */
+extern void vSetPipe(const int64_t iPipeBytes);
+
 } // ps::lib::nsStreamLocator
 
 } // ps::lib
@@ -25,10 +25,14 @@
 #include <unistd.h>
 #include <sys/wait.h>
 #include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <poll.h>
 #include <fcntl.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <deque>
 #include <exception>
 #include <functional>
 #include <iomanip>
@@ -36,6 +40,7 @@
 #include <iostream>
 #include <map>
 #include <mutex>
+#include <queue>
 #include <set>
 #include <sstream>
 #include <string>
@@ -83,6 +88,7 @@ namespace spf = std::placeholders;
 #include <boost/utility.hpp>
 #include <boost/any.hpp>
 #include <boost/asio.hpp>
+#include <boost/crc.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/fstream.hpp>
 #include <boost/format.hpp>
@@ -97,6 +103,16 @@ namespace spf = std::placeholders;
 #include <boost/range.hpp>
 #include <boost/range/algorithm.hpp>
 
+#include <zlib.h>                  // for the gzip scheme
+#ifdef PS_HAVE_ZSTD
+#include <zstd.h>                  // for the zstd scheme
+#endif
+#ifdef PS_HAVE_LZ4
+#include <lz4frame.h>              // for the lz4 scheme
+#endif
+#ifdef PS_HAVE_LIBURING
+#include <liburing.h>              // for the direct scheme
+#endif
 #include <occi.h>                  // Programing interfaces for Oracle client
 #include <sqlite3ext.h>            // Programing interfaces for Sqlite3
 //#include <google/profiler.h>       // for the diagnosis.
@@ -127,19 +143,29 @@ namespace spf = std::placeholders;
 #include "nsEffector.h"
 #include "cSemaphore.h"
 #include "cPool.h"
+#include "cTaskPool.h"
 #include "cSignal.h"
 #include "sql/nsSql.h"
+#include "cSlab.h"
+#include "cSlabWriter.h"
+#include "cManifest.h"
+#include "cFloatFormatter.h"
 #include "cDelimiter.h"
 #include "cIntervalTimer.h"
 #include "sql/cCtrlFile.h"
+#include "cScheduler.h"
 #include "cDispatcher.h"
 #include "nsStreamLocator/nsStreamLocator.h"
 #include "nsStreamLocator/cStreamSupplier.h"
 #include "nsStreamLocator/cStreamLocator.h"
+#include "nsStreamLocator/cPipeSink.h"
 #include "nsStreamLocator/cLocalProcess.h"
 #include "nsStreamLocator/cNamedPipe.h"
 #include "nsStreamLocator/cAsyncRedirector.h"
 #include "nsStreamLocator/cFileSystem.h"
+#include "nsStreamLocator/cCompressedFile.h"
+#include "nsStreamLocator/cDirectFile.h"
+#include "nsStreamLocator/cPlacement.h"
 // ps::lib::sql
 #include "sql/cFetchable.h"
 // ps::lib::sql::occi
@@ -151,11 +177,15 @@ namespace spf = std::placeholders;
 #include "sql/occi/cDefine.h"
 #include "sql/occi/cFailover.h"
 #include "sql/occi/cAllocator.h"
+#include "sql/occi/cNumberDecoder.h"
+#include "sql/occi/cDateFormatter.h"
 #include "sql/occi/cSvc.h"
 #include "sql/occi/cSetCurrentSchema.h"
 #include "sql/occi/cAttr.h"
 #include "sql/occi/cStmt.h"
+#include "sql/occi/cEncoderPlan.h"
 #include "sql/occi/cMetaData.h"
+#include "sql/occi/cRowidSplitter.h"
 #include "sql/occi/cUnloader.h"
 // ps::lib::sql::lite3
 #include "sql/lite3/cSqliteDb.h"
@@ -55,6 +55,14 @@ public:
      * @copydoc ps::lib::sql::cCtrlFileImpl::sGetGrammar
      */
     std::string sGetGrammar(void) const;
+    /**
+     * @copydoc ps::lib::sql::cCtrlFileImpl::vAddInfile
+     */
+    void vAddInfile(const boost::filesystem::path& sFileName);
+    /**
+     * @copydoc ps::lib::sql::cCtrlFileImpl::vSetAppend
+     */
+    void vSetAppend();
 private:
     std::unique_ptr<cCtrlFileImpl> oImpl_;
 };
@@ -78,6 +78,12 @@ public:
      * @brief
      */
     virtual void vFinalizeAction() =0;
+    /**
+     * @brief
+     * - Estimated amount of bytes to be unloaded, which is used to order the tasks.
+     * @return 0 if it is unknown.
+     */
+    virtual int64_t iGetEstimatedBytes() const { return 0; }
 };
 
 } // ps::lib::sql
@@ -34,19 +34,69 @@ namespace occi
 {
 
 /**
- * RAW memory allocate pool
+ * @class cAllocator
+ * @brief
+ * - RAW memory allocate pool, installed as the memory callbacks of an OCI environment.
+ * - Requests are rounded up to a power-of-two size class. Blocks of a class
+ *   are carved from large chunks, and freed blocks are kept in the free list
+ *   of the class to be reused. Chunks are released when the instance is destructed.
+ * - Free lists are split into shards, and a thread always uses the same shard.
+ *   Therefore threads sharing one environment rarely contend for a lock.
+ * - Each block is prefixed with a header holding its class and requested size,
+ *   so that no lookup is necessary when it is freed or reallocated.
+ * - Requests larger than the largest class are passed to ::malloc.
  */
 class cAllocator
 {
 private:
+    /**
+     * @struct tHeader
+     * @brief Put in front of each block. Its size keeps the alignment of ::malloc.
+     */
+    struct alignas(16) tHeader
+    {
+        uint32_t iClass_;  ///< Index of the size class, or LARGE_CLASS.
+        size_t iSize_;     ///< Size requested by the caller.
+    };
+    static constexpr uint32_t NUM_CLASSES = 12;       ///< 32 Bytes to 64 KiB.
+    static constexpr uint32_t MIN_CLASS_SHIFT = 5;
+    static constexpr uint32_t LARGE_CLASS = NUM_CLASSES;
+    static constexpr size_t CHUNK_SIZE = 1 << 20;
+    static constexpr uint32_t NUM_SHARDS = 8;
+    /**
+     * @struct tShard
+     * @brief Free lists and the chunk being carved, used by some threads.
+     */
+    struct tShard
+    {
+        std::mutex mtx_;
+        tHeader* oFree_[NUM_CLASSES];  ///< Heads of the intrusive free lists.
+        char* pCur_;                   ///< Unused part of the current chunk.
+        char* pEnd_;
+        std::vector<char*> oChunks_;
+        tShard();
+    };
     ps::lib::cTracer& trc_;
-    ps::lib::cSet<uint8_t*> m_;
-    std::mutex mtx_;
-    uint64_t iMaloc, iRaloc, iMfree;
+    tShard oShards_[NUM_SHARDS];
+    std::atomic<uint64_t> iMaloc, iRaloc, iMfree;
+    std::atomic<uint64_t> iReused_;    ///< Allocations satisfied by the free lists.
+    std::atomic<uint64_t> iLarge_;     ///< Allocations passed to ::malloc.
+    std::atomic<uint64_t> iChunks_;
+    static uint32_t iClassOf(const size_t& size);
+    static size_t iBlockSize(const uint32_t& iClass) { return size_t(1) << (iClass + MIN_CLASS_SHIFT); }
+    /// @brief Returns the shard assigned to the calling thread.
+    tShard& oShard();
+    cAllocator(const cAllocator&) =delete;
+    cAllocator& operator=(const cAllocator&) =delete;
 public:
     cAllocator();
     ~cAllocator();
     void* maloc(size_t size);
+    /**
+     * @brief
+     *   The contents are kept up to the smaller of the old and new size.
+     *   A null memptr is the same as maloc.
+     */
     void* raloc(void* memptr, size_t newsize);
     void mfree(void* memptr);
 };
@@ -38,6 +38,26 @@ class cAttr
 public:
     typedef boost::ptr_vector<cAttr> tContainer;
     typedef tContainer::auto_type tPtr;
+    /// @brief Hands over a partially filled slab to be written, and empties it.
+    typedef std::function<void(ps::lib::cSlab&)> tSpill;
+    /**
+     * @struct tView
+     * @brief
+     *   Raw layout of the define-buffer set which is currently selected.
+     */
+    struct tView
+    {
+        const char* data_;   ///< Top of the data of the first row.
+        ub4 size_;           ///< Distance in bytes between two rows.
+        const sb2* ind_;
+        const ub2* length_;
+        bool iEnclose_;      ///< true if the value is enclosed as a string.
+        /// @brief When it is not null, each value is formatted by this
+        ///   straight into the output, instead of being copied.
+        ///   It returns the length written, which never exceeds iMaxLength_.
+        size_t (*fpFormat_)(const char* szValue, char* szDest);
+        ub4 iMaxLength_;
+    };
     static cAttr * oMakeInstance(
         const std::string& tag
         , ps::lib::sql::occi::cOciStmt& oOciStmt
@@ -52,24 +72,113 @@ public:
     virtual int32_t iGetBufMemSize() const =0;
     /**
      * @brief
+     *   It is called once for each bulk before calling vAppendTo.
+     * @param[in] iNumIter
+     *   Number of rows fetched by the bulk.
+     */
+    virtual void vBeginBulk(const ub4& iNumIter) const {}
+    /**
+     * @brief
+     *   Converts the value at the iRow th row of the bulk
+     *   and appends it to oSlab.
      *
-     * @param[in,out] oRowBuf 
-     *   xxxx
-     * @param[in] iNumIter 
-     *   xxxx
-     * @param[in] iSep 
-     *   xxxx
-     * @param[in] oDelim 
-     *   xxxx
-     *
+     * @param[in,out] oSlab
+     *   A buffer which one bulk of rows is serialized into.
+     * @param[in] iRow
+     *   Position of the row in the bulk. Originated zero.
+     * @param[in] iSep
+     *   false indicates a last clolumn in the select list.
+     * @param[in] oDelim
+     *   Delimiters to be applied.
      */
-    virtual void vConvertStringVct(
-        ps::lib::str_vct& oRowBuf
-        , const ub4& iNumIter
+    virtual void vAppendTo(
+        ps::lib::cSlab& oSlab
+        , const ub4& iRow
         , const bool& iSep
         , const ps::lib::cDelimiter& oDelim
     ) const =0;
+    /**
+     * @brief
+     *   It is called once for each bulk after all rows were appended.
+     * @param[in] iNumIter
+     *   Number of rows fetched by the bulk.
+     */
+    virtual void vEndBulk(const ub4& iNumIter) const {}
+    /**
+     * @brief
+     *   Exposes the define-buffer to ps::lib::sql::occi::cEncoderPlan.
+     * @param[out] oView
+     *   Filled with the layout of the current define-buffer set.
+     * @return true if each value can be copied from the define-buffer
+     *   (or from the text already converted by vBeginBulk) as it is.
+     *   Otherwise vAppendTo must be used.
+     */
+    virtual bool iGetView(tView& oView) const { return false; }
     virtual std::string sGetFieldType() const =0;
+    /**
+     * @brief
+     * @return true if two or more define-buffer sets can be rotated
+     *   by cStmt::iFetch while fetching.
+     * @note
+     *   Columns fetched piecewise (LONG, LOB) or holding
+     *   descriptors (BFILE) always return false.
+     */
+    virtual bool iCanRotateBuffers() const { return false; }
+    /**
+     * @brief
+     *   Must be called before vSetDataBuffer.
+     * @param[in] iNumSets
+     *   Number of define-buffer sets to be allocated.
+     */
+    virtual void vSetNumBufferSets(const uint32_t& iNumSets) { BOOST_ASSERT(iNumSets == 1); }
+    /**
+     * @brief
+     *   Tells oDefine the address of the iSet th define-buffer set
+     *   that receives the next fetched rows.
+     */
+    virtual void vChangeDataBuffer(
+        ps::lib::sql::occi::cDefine& oDefine
+        , const uint32_t& iSet
+    ) const { BOOST_ASSERT(iSet == 0); }
+    /**
+     * @brief
+     *   Selects the define-buffer set read by vAppendTo.
+     */
+    virtual void vSelectBufferSet(const uint32_t& iSet) { BOOST_ASSERT(iSet == 0); }
+    /**
+     * @brief
+     *   Gives the way to write out the slab in the middle of vAppendTo.
+     *   Only columns streaming large values (LOB) make use of it.
+     * @param[in] fSpill
+     *   Called with the slab being filled when it has grown enough.
+     */
+    virtual void vSetSpill(const tSpill& fSpill) const {}
+    /**
+     * @brief
+     * @return true if vAppendTo streams the value piece by piece,
+     *   and may spill the slab in the middle of the row.
+     */
+    virtual bool iIsStreamed() const { return false; }
+    /**
+     * @brief
+     * - Appends the same as vAppendTo, except for the body of the streamed value.
+     * - It is used to measure the length of a row before streaming it.
+     * @return Length in bytes of the body left out.
+     */
+    virtual oraub8 iAppendHeaderTo(
+        ps::lib::cSlab& oSlab
+        , const ub4& iRow
+        , const ps::lib::cDelimiter& oDelim
+    ) const
+    {
+        vAppendTo(oSlab, iRow, false, oDelim);
+        return 0;
+    }
+    /**
+     * @brief
+     *   Appends the body left out by iAppendHeaderTo for the same row.
+     */
+    virtual void vAppendBodyTo(ps::lib::cSlab& oSlab, const ub4& iRow) const {}
 protected:
     cAttr() =default;
 private:
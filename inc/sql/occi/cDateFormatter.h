@@ -0,0 +1,121 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+namespace ps
+{
+
+namespace lib
+{
+
+namespace sql
+{
+
+namespace occi
+{
+
+/**
+ * @class cDateFormatter
+ * @brief
+ * - Formats date and time values fetched in binary (SQLT_DAT, OCIDateTime)
+ *   on the client, instead of letting the server convert them with the mask.
+ * - The mask (date_mask, timestamp_mask, timestamp_tz_mask) is compiled
+ *   into a sequence of operations once, and digits are written
+ *   by looking up a table. No strftime nor OCIDateTimeToText is called.
+ * - The supported elements are YYYY, YY, MM, DD, HH24, HH12, HH, MI, SS,
+ *   FF, FF1 to FF9, X, TZH, TZM, AM, PM, A.M., P.M.,
+ *   punctuations and quoted texts. Masks including any other elements
+ *   (e.g. MON, DAY, RR, TZR) are not supported. iIsSupported() returns false for them.
+ */
+class cDateFormatter
+{
+public:
+    /**
+     * @struct tDateTime
+     * @brief
+     *   Components of a date and time value.
+     */
+    struct tDateTime
+    {
+        sb2 iYear_;
+        ub1 iMonth_;
+        ub1 iDay_;
+        ub1 iHour_;
+        ub1 iMinute_;
+        ub1 iSecond_;
+        ub4 iNanoSec_;
+        sb1 iTzHour_;
+        sb1 iTzMinute_;
+    };
+private:
+    enum tKind
+    { iLiteral, iYear4, iYear2, iMonth, iDay, iHour24, iHour12
+    , iMinute, iSecond, iFraction, iTzHour, iTzMinute, iMeridian, iMeridianDot
+    };
+    struct tOp
+    {
+        tKind iKind_;
+        int32_t iArg_;         ///< Number of digits of iFraction.
+        std::string sLiteral_; ///< Text of iLiteral.
+    };
+    std::vector<tOp> oOps_;
+    bool iSupported_;
+    bool iNeedsTimeZone_;
+    size_t iMaxLength_;
+public:
+    /**
+     * @param [in] sMask
+     *   A format model of the date and time.
+     * @param [in] iScale
+     *   Precision of the fractional seconds, which is applied to FF.
+     */
+    cDateFormatter(const std::string& sMask, const int32_t& iScale);
+    bool iIsSupported() const { return iSupported_; }
+    /// @return true if the mask includes TZH or TZM.
+    bool iNeedsTimeZone() const { return iNeedsTimeZone_; }
+    /// @return the maximum length of the formatted string.
+    size_t iGetMaxLength() const { return iMaxLength_; }
+    /**
+     * @brief
+     *   Formats one value.
+     * @param [in] t
+     *   A value to be formatted.
+     * @param [out] szBuffer
+     *   At least iGetMaxLength() bytes. It is not terminated by null.
+     * @return the length of the formatted string.
+     */
+    size_t iFormat(const tDateTime& t, char* szBuffer) const;
+    /**
+     * @brief
+     *   Decodes the 7 bytes of SQLT_DAT.
+     */
+    static void vFromOciDate(const ub1* p, tDateTime& t);
+};
+
+} // ps::lib::sql::occi
+
+} // ps::lib::sql
+
+} // ps::lib
+
+} // ps
+
@@ -337,11 +337,28 @@ public:
         , uint16_t *rlenp
         , uint16_t *rcodep
     ){
-        BOOST_ASSERT(iTiming_ == tTiming::iOnce);
-        oMap_.at(i - 1).oAssign(
-            &value, sizeof(T), indp, rlenp, rcodep
-        );
+        vChangeAddr(i, &value, sizeof(T), indp, rlenp, rcodep);
     }
+    /**
+     * @brief
+     * - Same as above, but for an array of buffers which is not
+     *   laid out as a member of the user defined structure.
+     *
+     * @param [in] i        Originated 1.
+     * @param [in] valuep   Pointer to the first element of the array.
+     * @param [in] value_sz The size of each valuep buffer in bytes.
+     * @param [in] indp     pointer to an indicator variable or array.
+     * @param [in] rlenp    Pointer to array of length of data fetched.
+     * @param [in] rcodep   Pointer to array of column-level return codes.
+     */
+    void vChangeAddr(
+        const int32_t i
+        , void *valuep
+        , int32_t value_sz
+        , ps::lib::sql::ind_t *indp
+        , uint16_t *rlenp
+        , uint16_t *rcodep
+    );
     /**
      * @brief
      * - Sets the address of the structured memory to receive
@@ -0,0 +1,154 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+namespace ps
+{
+
+namespace lib
+{
+
+namespace sql
+{
+
+namespace occi
+{
+
+/**
+ * @class cEncoderPlan
+ * @brief
+ * - Serializes one bulk of rows held by the define-buffers into a ps::lib::cSlab.
+ * - It is built once for each statement after the describe,
+ *   and reused for every bulk fetched by the statement.
+ * - Each row is walked from left to right across the define-buffers.
+ * - Columns which expose their define-buffer (or the text converted
+ *   for the whole bulk by cAttr::vBeginBulk) by cAttr::iGetView
+ *   are copied, or formatted by cAttr::tView::fpFormat_, without virtual dispatch. The other columns
+ *   (LOBs, ...) are converted by cAttr::vAppendTo.
+ * - When a row holds columns streamed by cAttr::vAppendTo and each row is
+ *   prefixed with its length, the streamed bodies are left out by
+ *   cAttr::iAppendHeaderTo, because the prefix must be filled before any part
+ *   is spilled. They are appended by cAttr::vAppendBodyTo in their places
+ *   afterward, and the rest of the row is moved behind them.
+ * - The delimiter options are resolved once here. The loop over
+ *   the rows is instantiated for each combination of them,
+ *   so that they are not tested for every value.
+ * @note
+ *   It is not thread-safe. Each statement must own its instance.
+ */
+class cEncoderPlan
+{
+private:
+    /**
+     * @struct tOp
+     * @brief
+     *   An operation for one column.
+     */
+    struct tOp
+    {
+        const cAttr* oAttr_;
+        bool iCopy_;           ///< true if the value is copied from oView_ as it is.
+        bool iStreamed_;       ///< true if cAttr::iIsStreamed.
+        cAttr::tView oView_;   ///< Refreshed for each bulk.
+    };
+    /**
+     * @struct tBody
+     * @brief
+     *   A streamed body left out of the row being encoded.
+     */
+    struct tBody
+    {
+        const cAttr* oAttr_;
+        size_t iPos_;          ///< Position in the slab where the body belongs.
+    };
+    typedef void (cEncoderPlan::*tFp)(ps::lib::cSlab&, const ub4&) const;
+    const ps::lib::cDelimiter& oDelim_;
+    std::vector<tOp> oOps_;
+    const std::string sOpen_;   ///< Opening enclosure.
+    const std::string sClose_;  ///< Closing enclosure.
+    const std::string sColSep_;
+    const std::string sTail_;   ///< Last separator followed by row separator.
+    const int32_t iVarDigit_;
+    tFp fpEncode_;              ///< The instance of vEncodeRows selected by the delimiter options.
+    int32_t iNumStreamed_;      ///< Number of the columns streamed.
+    mutable std::vector<tBody> oBodies_;    ///< Bodies left out of the current row.
+    mutable std::string sRest_;             ///< The rest of the row moved behind the bodies.
+    /**
+     * @tparam kEnclose
+     *   true if the enclosures are not empty.
+     * @tparam kVarDigit
+     *   true if each row is prefixed with its length.
+     * @tparam kOneCharSep
+     *   true if the column separator is a single character.
+     */
+    template<bool kEnclose, bool kVarDigit, bool kOneCharSep>
+    void vEncodeRows(ps::lib::cSlab& oSlab, const ub4& iNumIter) const;
+    /**
+     * @brief
+     *   Appends the columns of one row, followed by the row separator.
+     * @param [out] pBodies
+     *   If not null, the streamed values are left out into oBodies_,
+     *   and the sum of their lengths is added.
+     */
+    template<bool kEnclose, bool kOneCharSep>
+    void vEncodeRow(ps::lib::cSlab& oSlab, const ub4& iRow, oraub8* pBodies) const;
+    cEncoderPlan(const cEncoderPlan&) =delete;
+    cEncoderPlan& operator=(const cEncoderPlan&) =delete;
+public:
+    /**
+     * @param [in] oAttrs
+     *   Columns of the statement. They must outlive this instance.
+     * @param [in] oDelim
+     *   Delimiters to be applied. It must outlive this instance.
+     * @param [in] tag
+     *   An identifier for the output of diagnosis.
+     */
+    cEncoderPlan(
+        const cAttr::tContainer& oAttrs
+        , const ps::lib::cDelimiter& oDelim
+        , const std::string& tag
+    );
+    /**
+     * @brief
+     *   Appends iNumIter rows of the define-buffer set which is currently selected.
+     * @param [in,out] oSlab
+     *   A buffer which one bulk of rows is serialized into.
+     * @param [in] iNumIter
+     *   Number of rows fetched by the bulk.
+     */
+    void vEncode(ps::lib::cSlab& oSlab, const ub4& iNumIter);
+    /**
+     * @brief
+     *   Passes fSpill to the columns which stream their values.
+     */
+    void vSetSpill(const cAttr::tSpill& fSpill) const;
+    bool iHasStreamed() const { return iNumStreamed_ > 0; }
+};
+
+} // ps::lib::sql::occi
+
+} // ps::lib::sql
+
+} // ps::lib
+
+} // ps
+
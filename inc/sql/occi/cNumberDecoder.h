@@ -0,0 +1,90 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+namespace ps
+{
+
+namespace lib
+{
+
+namespace sql
+{
+
+namespace occi
+{
+
+/**
+ * @class cNumberDecoder
+ * @brief
+ * - Converts the Oracle NUMBER in the internal format (SQLT_VNU)
+ *   to a string without calling OCINumberToText.
+ * - Imitates the output of OCINumberToText for the format models
+ *   which cNumberImpl::sMakeNumFmt makes, namely
+ *   "fm" followed by '9' or '0', an optional '.', '9' or '0',
+ *   and an optional "EEEE".
+ * - Format models of any other form (e.g. given by fpnumfmt with 'G' or 'D')
+ *   are not supported. iIsSupported() returns false for them.
+ *   'G' and 'D' are printed by NLS_NUMERIC_CHARACTERS of the session,
+ *   which is not known here, so such a column is always converted by OCINumberToText.
+ */
+class cNumberDecoder
+{
+private:
+    bool iSupported_;
+    bool iSci_;            ///< true when the format model ends with "EEEE".
+    bool iPoint_;          ///< true when the format model contains '.'.
+    int32_t iIntDigits_;   ///< Number of digits before '.'.
+    int32_t iMinIntDigits_;  ///< Digits always printed before '.', forced by '0'.
+    int32_t iFracDigits_;  ///< Number of digits after '.'.
+    int32_t iMinFracDigits_; ///< Digits always printed after '.', forced by '0'.
+public:
+    /**
+     * @param [in] sNumFmt
+     *   A format model given to OCINumberToText.
+     */
+    explicit cNumberDecoder(const std::string& sNumFmt);
+    bool iIsSupported() const { return iSupported_; }
+    /**
+     * @brief
+     *   Converts one value.
+     * @param [in] val
+     *   A value fetched as SQLT_VNU.
+     * @param [out] szBuffer
+     *   The string is written here. It is not terminated by null.
+     * @param [in,out] iBuffer
+     *   The capacity of szBuffer is given, and the length of the string is returned.
+     * @return false when the value is out of the scope of this decoder
+     *   (e.g. infinity, overflow of the format model, or a negative value rounded to zero).
+     *   In that case, OCINumberToText must be used instead.
+     */
+    bool iToText(const OCINumber* val, char* szBuffer, ub4& iBuffer) const;
+};
+
+} // ps::lib::sql::occi
+
+} // ps::lib::sql
+
+} // ps::lib
+
+} // ps
+
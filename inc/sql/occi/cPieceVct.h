@@ -46,6 +46,9 @@ namespace occi
  * -# Demand of memory can be minimized by dividing the data into pieces
  *    that are less than the specified length and retrieving it multiple times.<br />
  *    See also [About Providing FETCH Information at Run Time](https://docs.oracle.com/database/121/LNOCI/oci05bnd.htm#LNOCI16434).
+ * -# The buffer of each row grows geometrically while the pieces of a value
+ *    are received and is reused by the following batches, so that a long
+ *    value is copied a constant number of times on average.
  *
  * @par Example way to be used:
  * @code
@@ -74,12 +77,10 @@ private:
     int32_t iNumPcs_;
     /**
      * - Before each piecewise operation, initialize
-     *   with the maximum acceptable data length.
+     *   with the space remaining in the buffer of the row.
      * - When the callback function returns with OCI_CONTINUE,
      *   the length of the subsequent piecewise operation
      *   acquired piece is stored.
-     * - Therefore, in the last piece, the size is less than
-     *   or equal to cPieceVct::iPcsLen_.
      */
     ub4 iActual_;
     /**
@@ -88,18 +89,37 @@ private:
      */
     std::string::size_type iLongest_;
     /**
-     * - Maximum length of one piece:
+     * - Minimum length of one piece:
      *   specified in conf as "maxlongsize".
-     * - It determines the maximum amount of data received
-     *   at one time by piece operation and is used for
-     *   allocating memory and resetting cPieceVct::iActual_.
+     * - It determines the minimum amount of space offered
+     *   to a piece operation and is used for growing the buffer.
      */
     const int32_t iPcsLen_;
+    /**
+     * Upper limit of the size offered for the first piece,
+     * as a multiple of cPieceVct::iPcsLen_.
+     */
+    static constexpr std::string::size_type PIECE_ADAPT_RATIO = 64;
+    /**
+     * Capacity (in bytes) of the buffer held by each row,
+     * which is kept across batches to reuse the buffer.
+     */
+    std::vector<ub4> oCapacity_;
     char **data_;
     ps::lib::sql::ind_t *ind_;
     ub4 *length_;
     static char *& pGetDataAddr(void *src, const size_t& diff);
     static ub4 * pGetLengthAddr(ub4 *src, const size_t& diff);
+    /**
+     * @brief Returns the recorded capacity of the buffer of the row.
+     * @param [in] iter 0-based row number in the current fetch.
+     */
+    ub4& iCapacityAt(const ub4& iter);
+    /**
+     * @brief Size offered for the first piece of a value,
+     * adapted from cPieceVct::iLongest_.
+     */
+    ub4 iGetFirstPieceSize() const;
     cPieceVct(const cPieceVct& rhs) =delete;
     cPieceVct& operator=(const cPieceVct& rhs) =delete;
 public:
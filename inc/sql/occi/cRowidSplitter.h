@@ -0,0 +1,133 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#pragma once
+
+namespace ps
+{
+
+namespace lib
+{
+
+namespace sql
+{
+
+namespace occi
+{
+
+/**
+ * @class cRowidSplitter
+ * @brief
+ * - Hands out the block ranges of a table to the statements
+ *   of one ps::lib::sql::occi::cUnloader one after another.
+ * - The ranges given by the repository are cut on demand
+ *   (guided self-scheduling): a range taken is about 1/(2*N) of the rest,
+ *   where N is the number of statements, but not less than the minimum.
+ *   So the ranges get smaller as the queue drains, and the statements
+ *   finish at almost the same time even if the rows are distributed unevenly.
+ * - A range which spans two or more files is handed out as it is,
+ *   because the number of its blocks is unknown.
+ * @note
+ *   It is thread-safe.
+ */
+class cRowidSplitter
+{
+public:
+    /**
+     * @struct tRowid
+     * @brief
+     *   An extended ROWID, "OOOOOOFFFBBBBBBRRR" in base 64.
+     */
+    struct tRowid
+    {
+        uint32_t iObj_;     ///< Data object number.
+        uint32_t iFile_;    ///< Relative file number.
+        uint32_t iBlock_;
+        uint32_t iRow_;
+        static tRowid oDecode(const std::string& sRowid);
+        std::string sEncode() const;
+    };
+private:
+    /**
+     * @struct tRange
+     */
+    struct tRange
+    {
+        tRowid oBgn_;
+        tRowid oEnd_;
+        /// @return Number of blocks, 0 if it spans two or more files.
+        uint64_t iNumBlocks() const
+        {
+            return oBgn_.iFile_ == oEnd_.iFile_ && oBgn_.iBlock_ <= oEnd_.iBlock_
+                ? oEnd_.iBlock_ - oBgn_.iBlock_ + 1ULL
+                : 0ULL;
+        }
+    };
+    const static char szQuery[];
+    ps::lib::cTracer& trc_;
+    const std::string sTable_;  ///< Enclosed name of the table.
+    const uint64_t iNumLanes_;
+    const uint64_t iMinBlocks_;
+    std::mutex mtx_;            ///< to protect following members.
+    std::deque<tRange> oRanges_;
+    uint64_t iRestBlocks_;
+    int64_t iNumTaken_;
+    uint64_t iSmallest_;        ///< Number of blocks of the smallest range taken.
+    cRowidSplitter(const cRowidSplitter&) =delete;
+    cRowidSplitter& operator=(const cRowidSplitter&) =delete;
+public:
+    /**
+     * @param[in] sTable
+     *   Name of the table enclosed by double quotes.
+     * @param[in] iNumLanes
+     *   Number of the statements which take ranges at the same time.
+     * @param[in] iMinBlocks
+     *   A range is not cut into smaller than this.
+     */
+    cRowidSplitter(
+        const std::string& sTable
+        , const int32_t& iNumLanes
+        , const int32_t& iMinBlocks
+    );
+    ~cRowidSplitter();
+    /**
+     * @brief
+     *   Appends a range given by the repository (ROWID_RANGES.PREDB and PREDE).
+     */
+    void vAddRange(const std::string& sBgn, const std::string& sEnd);
+    /**
+     * @brief
+     *   Takes the next range from the head of the queue.
+     * @param[out] sql
+     *   SQL-Select for the range taken.
+     * @return false if no range is left.
+     */
+    bool iTake(std::string& sql);
+};
+
+} // ps::lib::sql::occi
+
+} // ps::lib::sql
+
+} // ps::lib
+
+} // ps
@@ -60,6 +60,9 @@ private:
     std::unique_ptr<oracle::occi::Statement, ps::lib::sql::occi::cStmtDeleter> stmt_;
     std::unique_ptr<oracle::occi::ResultSet, ps::lib::sql::occi::cRsDeleter> rs_;
     int32_t iFeedBack_;
+    /// @brief Number of define-buffer sets rotated while fetching.
+    ///   Greater than 1 means that fetching and converting are overlapped.
+    uint32_t iNumBufferSets_;
     bool iFetchHasDone_;
     ps::lib::sql::occi::cAttr::tContainer oAttrs_; ///< stores retrieved data from SQL select
 
@@ -69,6 +72,21 @@ private:
     void vPrepareAndBind();
     void vExecuteQuery();
     void vAnalyzeDescribe();
+    /**
+     * @brief
+     * - Decides how many define-buffer sets are allocated for each column.
+     * @return 1 if the pipelined fetching is not applicable.
+     */
+    uint32_t iDecideNumBufferSets() const;
+    /**
+     * @brief
+     * - Body of iFetch when iNumBufferSets_ > 1.
+     * - While the rows of the batch k is converted in the current thread
+     *   with cFetchable::vPostBulkAction, the batch k+1 is fetched into
+     *   another define-buffer set by a companion thread.
+     * @return Number of rows fetched.
+     */
+    uint32_t iFetchPipelined(ps::lib::sql::cFetchable& fetchable);
 
 public:
     cStmt(
@@ -111,6 +129,9 @@ public:
      * - If virtual functions are defined in a user-defined class that
      *   inherits cFetchable, you can call back these at the timing
      *   before and after each fetch operation.
+     * - When two or more define-buffer sets are allocated (see the
+     *   "fetch_pipeline_depth" option), these are called back on
+     *   a companion thread while the next rows are being fetched.
      * @param [in,out] ep
      *   Share exceptions that occurred in the current thread
      *   with the calling thread
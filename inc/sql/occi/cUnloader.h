@@ -52,15 +52,12 @@ private:
     ps::lib::cTracer& trc_;      ///< output to the tracing file.
     ps::lib::cDistributor& mos_; ///< to make it possible to aggregate one console and one trace to one stream.
     typedef ps::lib::cSpinLock<int64_t, std::micro> spinlock_t;
-    spinlock_t spin_;            ///< to protect the I/O integrity from the multiple access.
-    int32_t iTls_;               ///< is used to count number of TLSs.
-    /// @brief A smart pointer pointing to an int32_t type that is used to pick up an element
-    ///   from the @ref oCont_.
-    /// @note It is used as a subscript for maintaining / referencing the context of thread
-    ///   by assigning ordinal numbers of constants unique to each thread.
-    boost::thread_specific_ptr<int32_t> oTls_;
+    ps::lib::sql::occi::cSvc& oSvc_;
+    /// @brief to protect tValue::oStmt_ from the multiple access.
+    mutable spinlock_t spin_;
     std::atomic<int64_t> iTotalBytes_; ///< accumulates total written bytes of amount.
     std::atomic<uint32_t> iTotalRows_;
+    int64_t iEstimatedBytes_;    ///< is given by the repository, 0 if it is unknown.
     std::string fbase_;          ///< A base name (exclude an extention) of data (and control) file.
     /**
      * @brief
@@ -70,6 +67,27 @@ private:
     const int32_t iNumLongs_;
     boost::filesystem::path sLastOpendFilenme_;
     std::string sPartitionName_;
+    /// @brief true if only the rows changed after @ref iSinceScn_ are unloaded.
+    const bool iIncremental_;
+    /// @brief SCN which the task was unloaded up to by the previous run, bound to :b_last_scn.
+    int64_t iSinceScn_;
+    ps::lib::sql::occi::cBind oDeltaBind_;
+    /// @brief Size to roll the data file over to the next piece, 0 if it is not rolled.
+    const int64_t iPieceBytes_;
+    /// @brief Data files written, one unless it is rolled.
+    std::vector<boost::filesystem::path> oPieces_;
+    /// @return @ref oPieces_ separated by ps::lib::cManifest::szPieceSep.
+    std::string sGetPieces() const;
+    /**
+     * @brief
+     *   Adds the predicate "ORA_ROWSCN > :b_last_scn" to the statement generated
+     *   for a table, which is "SELECT * FROM table [WHERE condition]".
+     * @note ORA_ROWSCN is tracked per block unless the table has ROWDEPENDENCIES,
+     *   so that the rows selected may be a superset of the rows changed.
+     * @note ORA_ROWSCN is not supported by a flashback query, so the statement
+     *   must not have "AS OF SCN". See ps::app::xtru::getdata::cStartValues::vSettleScn.
+     */
+    std::string sRestrictToChanges(const std::string& sql) const;
     /**
      * @brief
      * @struct tValue
@@ -78,18 +96,17 @@ private:
     {
         std::unique_ptr<ps::lib::sql::occi::cStmt> oStmt_;
         uint32_t iNumRows_;
-        ps::lib::str_vct oRowBuf_;
-        std::future<uint32_t> oFuture_;
-        std::unique_ptr<std::thread> oThr_;
-        std::thread::id iTid_;
+        ps::lib::cSlabWriter::tSlabPtr oSlab_; ///< One bulk of rows is serialized into here.
+        /// @brief Built after the statement was described.
+        std::unique_ptr<ps::lib::sql::occi::cEncoderPlan> oPlan_;
+        std::thread::id iTid_;       ///< The worker which fetched rows.
         tValue(
             ps::lib::sql::occi::cStmt* oStmt
             , const uint32_t& iBulkSize
         )
             : oStmt_(oStmt)
             , iNumRows_(0U)
-            , oRowBuf_(iBulkSize, ps::lib::str_vct::value_type())
-            , oThr_(nullptr)
+            , oSlab_(new ps::lib::cSlab)
         {}
     };
     /**
@@ -98,6 +115,20 @@ private:
      * - Every array element is associated with SQL-Select.
      */
     ps::lib::cVector<tValue> oCont_;
+    class cBulkHandler;
+    /**
+     * @brief
+     *   Takes the rest of the table by small rowid ranges, if @ref oSplitter_ is given.
+     */
+    std::unique_ptr<ps::lib::sql::occi::cRowidSplitter> oSplitter_;
+    /// @brief Builds tValue::oPlan_ for tValue::oStmt_ which has been executed.
+    void vSetUpPlan(tValue& oItem);
+    /**
+     * @brief
+     *   Fetches rows by tValue::oStmt_, and the ranges taken from @ref oSplitter_ in turn.
+     * @return Number of rows fetched.
+     */
+    uint32_t iFetchAll(tValue& oItem, std::exception_ptr& ep);
     /**
      * @brief
      * @return a string which is stored column names list
@@ -129,6 +160,8 @@ protected:
     std::unique_ptr<std::ostream> st_ctrl_;
     /// @brief A handole of the data file for the SQL*Loader
     std::unique_ptr<std::ostream> st_data_;
+    /// @brief The only thread which writes to @ref st_data_ while fetching.
+    std::unique_ptr<ps::lib::cSlabWriter> oWriter_;
     /**
      * @brief
      */
@@ -154,41 +187,53 @@ protected:
     /**
      * @brief
      */
-    void vClearBuffer();
+    void vClearBuffer(tValue& oItem);
     /**
      * @brief
      * # RAW data(s) on the OCI array interface (It is attached by calling
-     *     ps::lib::sql::occi::vDefineArrayOfStruct() function) are converted to
-     *     ps::lib::str_vct (oRowBuf) by this function.<br/>
-     *   the method of reading the OCI array data appropriate to the data type of <br/>
-     *   each column is dynamically selected at runtime, <br/>
-     *   becaouse ps::lib::sql::occi::cAttr::vConvertStringVct() is a virtual function,
-     * # Invoke this function to fill the oRowBuf_ of tValue with OCI array data
-     *   before calling vPutRowsToDataFile().
-     * @param[in] iCol
-     *   indicates position of the column. Originated zero.
+     *     ps::lib::sql::occi::vDefineArrayOfStruct() function) are converted
+     *     and serialized row by row into the oSlab_ of tValue by this function.<br/>
+     * # The work is delegated to the oPlan_ of tValue, which was built
+     *   for the statement and the delimiters in advance.
+     * # Invoke this function before calling vPutRowsToDataFile().
      * @param[in] iNumIter
      *   takes a value of range which is between 1 and iBulkSize.
-     * @param[in] iSep
-     *   false indicates a last clolumn in the select list.
      */
-    void vSetRowBuf(
-        const int32_t& iCol
-        , const uint32_t& iNumIter
-        , const bool& iSep
-    );
+    void vSerializeRows(tValue& oItem, const uint32_t& iNumIter);
     /**
      * @brief
-     * - Assemble one bulk rows based on formatting and dispatch to ostream.
-     * - With thread safe, multiple accesses to ostream are serialized.
+     * - Hands one bulk rows serialized in oSlab_ over to @ref oWriter_,
+     *   which writes it to ostream by one write.
+     * - The calling thread does not wait for the I/O unless the queue of the writer is full.
      * @param[in] iNumIter
      */
-    void vPutRowsToDataFile(const uint32_t& iNumIter);
+    void vPutRowsToDataFile(tValue& oItem, const uint32_t& iNumIter);
     /**
      * @brief
      * - generates a control file used for SQL*Loader.
+     * - When the data file is rolled, one more control file is generated for each piece.
      */
     void vPutGrammerToCtrlFile();
+    /**
+     * @brief
+     * - opens the control file of the piece which is selected into st_ctrl_.
+     * @return The directory of the control file.
+     */
+    boost::filesystem::path sOpenCtrlFile();
+    /**
+     * @return
+     *   The name of sPiece for INFILE, which is the file name if it is placed in sCtrlDir,
+     *   otherwise the absolute path, e.g. when cPlacement chose another directory.
+     */
+    boost::filesystem::path sGetInfile(
+        const boost::filesystem::path& sPiece
+        , const boost::filesystem::path& sCtrlDir
+    ) const;
+    /**
+     * @brief
+     * - writes oCtrlFile to the control file opened by sOpenCtrlFile, and closes it.
+     */
+    void vWriteCtrlFile(const ps::lib::sql::cCtrlFile& oCtrlFile);
     /**
      * @brief
      * @return a number of the columns as integer.
@@ -277,14 +322,11 @@ public:
      *    They indicate where control file and data file are stored, respectively.
      *  -# Executes a SQL-Select statement saved as tValue::oStmt_ in @ref oCont_.<br/>
      *    This operation is ran in the current thread.
-     *  -# Reserves delayed fetching using std::packaged_task.<br/>
-     *    On this time,
-     *    <a href="http://en.cppreference.com/w/cpp/thread/packaged_task">std::packaged_task</a>
-     *    hooks ps::lib::sql::occi::cStmt::iFetch().<br/>
-     *    And as context, oStmt_ is passed to the argument of the constructor.<br/>
-     *    The hooked function is asynchronously handled by another thread on background.
+     *  -# Submits ps::lib::sql::occi::cStmt::iFetch() of oStmt_ to ps::lib::cScheduler.<br/>
+     *    It is run by a worker of the scheduler, or by the current thread while waiting,
+     *    so that the sub-statements never exceed the global number of workers.
      *  -# About all elements of @ref oCont_, Repeats the process from No.2.
-     *  -# Joins all queued tasks to the current thread. When asynchronous processing is completed,<br/>
+     *  -# Waits for all submitted tasks. When asynchronous processing is completed,<br/>
      *    the number of rows read is returned to tValue::iNumRows_.
      *  -# About how many number of bytes and rows written, It is reported to the tracing file.
      *  -# Finally, Closes two ostreams.
@@ -321,14 +363,32 @@ public:
      *   It is executed only once regardless of whether or not a record is read.
      */
     virtual void vFinalizeAction();
+    /**
+     * @brief
+     *   Gives the estimated size of the table, partition or rowid range to be unloaded.
+     */
+    void vSetEstimatedBytes(const int64_t& iEstimatedBytes);
+    virtual int64_t iGetEstimatedBytes() const;
+    /**
+     * @brief
+     * - Gives the queue of rowid ranges of the table.
+     * - Each statement passed to the constructor takes the next range from it
+     *   when it has fetched all rows, until the queue is empty.
+     * @param[in] oSplitter
+     *   The ownership is passed.
+     */
+    void vSetRowidSplitter(ps::lib::sql::occi::cRowidSplitter* oSplitter);
     /**
      * @brief
      *   It is repeatedly executed before reading is completed in 1 bulk unit.
+     * @note The statements of this class are fetched with cBulkHandler, which knows
+     *   the element of @ref oCont_. This one is only for a single statement fetched with this.
      */
     virtual void vPreBulkAction(const uint32_t& iBulkSize);
     /**
      * @brief
      *   It is repeatedly executed after reading is completed in 1 bulk unit.
+     * @note Same as vPreBulkAction.
      */
     virtual void vPostBulkAction(const uint32_t& iNumIter);
     /**
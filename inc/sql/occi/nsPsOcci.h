@@ -97,6 +97,38 @@ void vLobFileGetName(
     , boolean *bFlag
 );
 
+    extern
+oraub8 iLobGetLength(
+    cOciStmt& oOciStmt
+    , OCILobLocator *locp
+);
+
+/**
+ * @brief
+ *   Reads one piece of a LOB in the polling mode.
+ * @param [in] piece
+ *   OCI_FIRST_PIECE for the first call, OCI_NEXT_PIECE for the others.
+ * @param [out] iRead
+ *   Number of bytes stored in buf.
+ * @return true if more pieces remain.
+ */
+    extern
+bool iLobRead(
+    cOciStmt& oOciStmt
+    , OCILobLocator *locp
+    , const ub1& csfrm
+    , char *buf
+    , const oraub8& bufl
+    , const ub1& piece
+    , oraub8& iRead
+);
+
+    extern
+ub4 iNlsMaxByteSize(
+    cOciErr& oOciErr
+    , const ub1& csfrm
+);
+
     extern
 void vNumberToText(
     cOciErr& oOciErr
@@ -105,6 +137,21 @@ void vNumberToText(
     , char *szBuffer, ub4& iBuffer
 );
 
+    extern
+void vDateTimeGetDateTime(
+    cOciErr& oOciErr
+    , OCIDateTime *val
+    , sb2 *yr, ub1 *mnth, ub1 *dy
+    , ub1 *hr, ub1 *mm, ub1 *ss, ub4 *fsec
+);
+
+    extern
+void vDateTimeGetTimeZoneOffset(
+    cOciErr& oOciErr
+    , const OCIDateTime *val
+    , sb1 *hr, sb1 *mm
+);
+
     extern
 void vDefineArrayOfStruct(
     cOciStmt& oOciStmt
@@ -0,0 +1,398 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <pslib.h>
+
+namespace ps
+{
+
+namespace lib
+{
+
+namespace
+{
+
+/**
+ * @struct tDiyFp
+ * @brief
+ *   A floating-point number whose value is f * 2^e.
+ */
+struct tDiyFp
+{
+    uint64_t f;
+    int32_t e;
+    tDiyFp() : f(0), e(0) {}
+    tDiyFp(const uint64_t& f_, const int32_t& e_) : f(f_), e(e_) {}
+    tDiyFp operator-(const tDiyFp& rhs) const
+    {
+        BOOST_ASSERT(e == rhs.e && f >= rhs.f);
+        return tDiyFp(f - rhs.f, e);
+    }
+    /// @brief Multiplies the mantissas and rounds the lower 64 bits.
+    tDiyFp operator*(const tDiyFp& rhs) const
+    {
+        const uint64_t M32 = 0xFFFFFFFF;
+        const uint64_t a = f >> 32, b = f & M32;
+        const uint64_t c = rhs.f >> 32, d = rhs.f & M32;
+        const uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+        uint64_t tmp = (bd >> 32) + (ad & M32) + (bc & M32);
+        tmp += 1U << 31;
+        return tDiyFp(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), e + rhs.e + 64);
+    }
+    tDiyFp normalize() const
+    {
+        tDiyFp r(*this);
+        while (! (r.f & (uint64_t(1) << 63)))
+        {
+            r.f <<= 1;
+            --r.e;
+        }
+        return r;
+    }
+};
+
+/**
+ * @class cCachedPowers
+ * @brief
+ * - Normalized 10^k for k = -348, -340, ..., 340.
+ * - They are computed once by the multiple-precision arithmetic,
+ *   instead of being written as a table of magic numbers.
+ */
+class cCachedPowers
+{
+public:
+    enum { MIN_EXP10 = -348, STEP = 8, NUM_POWERS = 87 };
+private:
+    tDiyFp oPowers_[NUM_POWERS];
+    typedef std::vector<uint32_t> tBig; // little endian.
+    static void vMulSmall(tBig& x, const uint32_t& m)
+    {
+        uint64_t carry = 0;
+        for (auto& w: x)
+        {
+            const uint64_t t = uint64_t(w) * m + carry;
+            w = static_cast<uint32_t>(t);
+            carry = t >> 32;
+        }
+        if (carry) x.push_back(static_cast<uint32_t>(carry));
+    }
+    static void vDivSmall(tBig& x, const uint32_t& m)
+    {
+        uint64_t rem = 0;
+        for (auto i = x.size(); i-- > 0; )
+        {
+            const uint64_t t = (rem << 32) | x[i];
+            x[i] = static_cast<uint32_t>(t / m);
+            rem = t % m;
+        }
+        while (x.size() && x.back() == 0) x.pop_back();
+    }
+    static int32_t iBitLength(const tBig& x)
+    {
+        auto n = static_cast<int32_t>(x.size()) * 32;
+        for (auto w = x.back(); ! (w & 0x80000000U); w <<= 1) --n;
+        return n;
+    }
+    static bool iBit(const tBig& x, const int32_t& i)
+    {
+        return i >= 0 && (x[i / 32] >> (i % 32)) & 1;
+    }
+    /// @brief Rounds x to the upper 64 bits. The value is (result * 2^(return value)).
+    static tDiyFp oTop64(const tBig& x)
+    {
+        const auto n = iBitLength(x);
+        uint64_t f = 0;
+        for (auto i = n - 1; i >= n - 64; --i)
+        {
+            f = (f << 1) | iBit(x, i);
+        }
+        tDiyFp r(f, n - 64);
+        if (iBit(x, n - 65))
+        {
+            if (++r.f == 0)
+            {
+                r.f = uint64_t(1) << 63;
+                ++r.e;
+            }
+        }
+        return r;
+    }
+public:
+    cCachedPowers()
+    {
+        for (auto i = 0; i < NUM_POWERS; ++i)
+        {
+            const auto k = MIN_EXP10 + i * STEP;
+            if (k >= 0)
+            {
+                tBig x(1, 1);
+                for (auto j = 0; j < k; ++j) vMulSmall(x, 10);
+                oPowers_[i] = oTop64(x);
+            }
+            else
+            {
+                // 2^m / 10^-k keeps enough bits below the upper 64 bits.
+                const int32_t m = 64 + 128 + static_cast<int32_t>(-k * 3.3219280948873623) + 1;
+                tBig x(m / 32 + 1, 0);
+                x[m / 32] = uint32_t(1) << (m % 32);
+                for (auto j = 0; j < -k; ++j) vDivSmall(x, 10);
+                oPowers_[i] = oTop64(x);
+                oPowers_[i].e -= m;
+            }
+        }
+    }
+    /**
+     * @brief
+     *   Picks up c = 10^-K, so that the exponent of (w * c) is in [-59, -32].
+     */
+    const tDiyFp& oGet(const int32_t& e, int32_t& K) const
+    {
+        const double dk = (-61 - e) * 0.30102999566398114 + 347;
+        auto k = static_cast<int32_t>(dk);
+        if (dk - k > 0.0) ++k;
+        const auto index = static_cast<uint32_t>((k >> 3) + 1);
+        K = -(MIN_EXP10 + static_cast<int32_t>(index * STEP));
+        BOOST_ASSERT(index < NUM_POWERS);
+        return oPowers_[index];
+    }
+};
+
+const cCachedPowers oCachedPowers;
+
+const uint32_t iPow10[] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+int32_t iCountDigits(const uint32_t& n)
+{
+    auto i = 1;
+    while (i < 10 && n >= iPow10[i]) ++i;
+    return i;
+}
+
+void vGrisuRound(
+    char* buffer, const int32_t& len, const uint64_t& delta
+    , uint64_t rest, const uint64_t& ten_kappa, const uint64_t& wp_w
+)
+{
+    while (rest < wp_w && delta - rest >= ten_kappa
+        && (rest + ten_kappa < wp_w || wp_w - rest > rest + ten_kappa - wp_w))
+    {
+        --buffer[len - 1];
+        rest += ten_kappa;
+    }
+}
+
+/**
+ * @brief
+ *   Generates the digits of W between the boundaries (Mp - delta, Mp).
+ */
+void vDigitGen(const tDiyFp& W, const tDiyFp& Mp, uint64_t delta, char* buffer, int32_t& len, int32_t& K)
+{
+    const tDiyFp one(uint64_t(1) << -Mp.e, Mp.e);
+    const tDiyFp wp_w = Mp - W;
+    auto p1 = static_cast<uint32_t>(Mp.f >> -one.e);
+    auto p2 = Mp.f & (one.f - 1);
+    auto kappa = iCountDigits(p1);
+    len = 0;
+    while (kappa > 0)
+    {
+        const auto d = p1 / iPow10[kappa - 1];
+        p1 %= iPow10[kappa - 1];
+        if (d || len) buffer[len++] = static_cast<char>('0' + d);
+        --kappa;
+        const auto tmp = (static_cast<uint64_t>(p1) << -one.e) + p2;
+        if (tmp <= delta)
+        {
+            K += kappa;
+            vGrisuRound(buffer, len, delta, tmp, static_cast<uint64_t>(iPow10[kappa]) << -one.e, wp_w.f);
+            return;
+        }
+    }
+    for (;;)
+    {
+        p2 *= 10;
+        delta *= 10;
+        const auto d = static_cast<char>(p2 >> -one.e);
+        if (d || len) buffer[len++] = static_cast<char>('0' + d);
+        p2 &= one.f - 1;
+        --kappa;
+        if (p2 < delta)
+        {
+            K += kappa;
+            const auto index = -kappa;
+            vGrisuRound(buffer, len, delta, p2, one.f, wp_w.f * (index < 10 ? iPow10[index] : 0));
+            return;
+        }
+    }
+}
+
+/**
+ * @brief
+ *   Shortest digits of a positive finite value f * 2^e,
+ *   whose hidden bit is iHidden. The value is digits * 10^K.
+ */
+void vGrisu2(const uint64_t& f, const int32_t& e, const uint64_t& iHidden, char* buffer, int32_t& len, int32_t& K)
+{
+    const tDiyFp v(f, e);
+    // Boundaries (the middle points between v and its neighbors).
+    const auto pl = tDiyFp((f << 1) + 1, e - 1).normalize();
+    auto mi = (f == iHidden) ? tDiyFp((f << 2) - 1, e - 2) : tDiyFp((f << 1) - 1, e - 1);
+    mi.f <<= mi.e - pl.e;
+    mi.e = pl.e;
+    const auto& c_mk = oCachedPowers.oGet(pl.e, K);
+    const auto W = v.normalize() * c_mk;
+    auto Wp = pl * c_mk;
+    auto Wm = mi * c_mk;
+    ++Wm.f;
+    --Wp.f;
+    vDigitGen(W, Wp, Wp.f - Wm.f, buffer, len, K);
+}
+
+/**
+ * @brief
+ *   Lays out the digits in the fixed-point or the exponential notation.
+ */
+size_t iLayOut(const bool& iNeg, const char* digits, const int32_t& len, const int32_t& K, char* szBuffer, const int32_t& iFixedDigits)
+{
+    auto q = szBuffer;
+    if (iNeg) *q++ = '-';
+    const auto kk = len + K; // 10^(kk-1) <= value < 10^kk
+    if (kk - 1 >= -4 && kk - 1 < iFixedDigits)
+    {
+        if (kk <= 0)
+        {
+            // e.g.) 0.00123
+            *q++ = '0';
+            *q++ = '.';
+            for (auto i = kk; i < 0; ++i) *q++ = '0';
+            ::memcpy(q, digits, len);
+            q += len;
+        }
+        else if (kk >= len)
+        {
+            // e.g.) 1234000
+            ::memcpy(q, digits, len);
+            q += len;
+            for (auto i = len; i < kk; ++i) *q++ = '0';
+        }
+        else
+        {
+            // e.g.) 12.34
+            ::memcpy(q, digits, kk);
+            q += kk;
+            *q++ = '.';
+            ::memcpy(q, digits + kk, len - kk);
+            q += len - kk;
+        }
+    }
+    else
+    {
+        // e.g.) 1.234E+25
+        *q++ = digits[0];
+        if (len > 1)
+        {
+            *q++ = '.';
+            ::memcpy(q, digits + 1, len - 1);
+            q += len - 1;
+        }
+        *q++ = 'E';
+        auto iExp = kk - 1;
+        if (iExp < 0)
+        {
+            *q++ = '-';
+            iExp = -iExp;
+        }
+        else
+        {
+            *q++ = '+';
+        }
+        if (iExp >= 100)
+        {
+            *q++ = static_cast<char>('0' + iExp / 100);
+        }
+        *q++ = static_cast<char>('0' + iExp / 10 % 10);
+        *q++ = static_cast<char>('0' + iExp % 10);
+    }
+    return q - szBuffer;
+}
+
+/**
+ * @brief
+ *   Common part for double and float.
+ */
+size_t iFormatBits(
+    const uint64_t& iBits, const int32_t& iSigBits, const int32_t& iExpBits
+    , char* szBuffer, const int32_t& iFixedDigits
+)
+{
+    const bool iNeg = (iBits >> (iSigBits + iExpBits)) & 1;
+    const auto iHidden = uint64_t(1) << iSigBits;
+    const auto iSig = iBits & (iHidden - 1);
+    const auto iExpMax = (1 << iExpBits) - 1;
+    const auto iBiased = static_cast<int32_t>((iBits >> iSigBits) & iExpMax);
+    const auto iBias = (iExpMax >> 1) + iSigBits;
+    if (iBiased == iExpMax)
+    {
+        static const std::string sNan = "NAN", sInf = "INF", sNegInf = "-INF";
+        const auto& s = iSig ? sNan : (iNeg ? sNegInf : sInf);
+        ::memcpy(szBuffer, s.data(), s.size());
+        return s.size();
+    }
+    if (iBiased == 0 && iSig == 0)
+    {
+        auto q = szBuffer;
+        if (iNeg) *q++ = '-';
+        *q++ = '0';
+        return q - szBuffer;
+    }
+    char digits[20];
+    int32_t len, K;
+    if (iBiased)
+    {
+        vGrisu2(iSig + iHidden, iBiased - iBias, iHidden, digits, len, K);
+    }
+    else
+    {
+        vGrisu2(iSig, 1 - iBias, iHidden, digits, len, K);
+    }
+    return iLayOut(iNeg, digits, len, K, szBuffer, iFixedDigits);
+}
+
+} // anonymous
+
+size_t cFloatFormatter::iFormat(const double& d, char* szBuffer, const int32_t& iFixedDigits)
+{
+    uint64_t iBits;
+    ::memcpy(&iBits, &d, sizeof(d));
+    return iFormatBits(iBits, 52, 11, szBuffer, iFixedDigits);
+}
+
+size_t cFloatFormatter::iFormat(const float& f, char* szBuffer, const int32_t& iFixedDigits)
+{
+    uint32_t iBits;
+    ::memcpy(&iBits, &f, sizeof(f));
+    return iFormatBits(iBits, 23, 8, szBuffer, iFixedDigits);
+}
+
+} // ps::lib
+
+} // ps
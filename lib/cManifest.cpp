@@ -0,0 +1,281 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <pslib.h>
+
+namespace ps
+{
+
+namespace lib
+{
+
+namespace
+{
+
+const char szStarted[] = "STARTED";
+const char szDone[] = "DONE";
+const char szScn[] = "#SCN";
+
+/// @return Total bytes of the pieces on the disk.
+int64_t iGetFileBytes(const std::vector<std::string>& oPieces, boost::system::error_code& ec)
+{
+    int64_t iSize = 0;
+    for (const auto& sPiece: oPieces)
+    {
+        boost::system::error_code ecPiece;
+        const auto iPiece = boost::filesystem::file_size(sPiece, ecPiece);
+        if (ecPiece)
+        {
+            ec = ecPiece;
+        }
+        else
+        {
+            iSize += static_cast<int64_t>(iPiece);
+        }
+    }
+    return iSize;
+}
+
+} // anonymous
+
+const char cManifest::szPieceSep[] = "|";
+
+/**
+ * @details
+ */
+cManifest::cManifest()
+    : trc_(ps::lib::cTracer::get_mutable_instance())
+    , iScn_(0)
+{}
+/**
+ * @details
+ */
+void cManifest::vOpen(const boost::filesystem::path& sPath, const bool& iRestart, const bool& iIncremental)
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    sPath_ = sPath;
+    oEntries_.clear();
+    oCompleted_.clear();
+    oBaseline_.clear();
+    iScn_ = 0;
+    if (sPath_.empty())
+    {
+        return;
+    }
+    if ((iRestart || iIncremental) && boost::filesystem::exists(sPath_))
+    {
+        boost::filesystem::ifstream ifs(sPath_);
+        std::string line;
+        auto iNumDone = 0, iNumPartial = 0, iNumCarried = 0;
+        int64_t iPrevScn = 0;
+        while (std::getline(ifs, line))
+        {
+            std::vector<std::string> oFields;
+            boost::split(oFields, line, boost::is_any_of("\t"));
+            if (oFields.size() == 2 && oFields[0] == szScn)
+            {
+                iPrevScn = boost::lexical_cast<int64_t>(oFields[1]);
+                continue;
+            }
+            // The manifest written before SCN and FILEBYTES columns were added has 6 or 7 fields.
+            if (oFields.size() < 6 || oFields.size() > 8)
+            {
+                continue;
+            }
+            tEntry oEntry = {
+                oFields[0] == szDone
+                , oFields[2]
+                , boost::lexical_cast<int64_t>(oFields[3])
+                , boost::lexical_cast<int64_t>(oFields[4])
+                , static_cast<uint32_t>(std::stoul(oFields[5], nullptr, 16))
+                , oFields.size() >= 7 ? boost::lexical_cast<int64_t>(oFields[6])
+                    : (oFields[0] == szDone ? iPrevScn : 0)
+                // The files of those old manifests are not compressed.
+                , oFields.size() == 8 ? boost::lexical_cast<int64_t>(oFields[7])
+                    : boost::lexical_cast<int64_t>(oFields[4])
+            };
+            if (oEntry.iScn_)
+            {
+                oBaseline_[oFields[1]] = oEntry.iScn_;
+            }
+            // Every row is carried forward until its task replaces it,
+            // so that a run interrupted loses neither the rows nor the baselines of the tasks not reached.
+            oEntries_[oFields[1]] = oEntry;
+            if ( ! iRestart)
+            {
+                // An incremental run reads only the baseline, and the files are rewritten.
+                continue;
+            }
+            // A row carried from an older run of the incremental one was not unloaded as of its SCN.
+            if (iIncremental && oEntry.iDone_ && oEntry.iScn_ != iPrevScn)
+            {
+                ++iNumCarried;
+                continue;
+            }
+            std::vector<std::string> oPieces;
+            boost::split(oPieces, oEntry.sFile_, boost::is_any_of(szPieceSep));
+            boost::system::error_code ec;
+            const auto iSize = iGetFileBytes(oPieces, ec);
+            // A file which was not closed or was modified afterward is unloaded again.
+            if (oEntry.iDone_ && ! ec && iSize == oEntry.iFileBytes_)
+            {
+                oCompleted_[oFields[1]] = oEntry;
+                ++iNumDone;
+            }
+            else
+            {
+                for (const auto& sPiece: oPieces)
+                {
+                    boost::filesystem::remove(sPiece, ec);
+                }
+                oEntries_[oFields[1]].iDone_ = false;
+                trc_ << boost::format("Rerunpoint: %s is partial, %s was deleted.")
+                    % oFields[1] % oEntry.sFile_ << std::endl;
+                ++iNumPartial;
+            }
+        }
+        if (iRestart)
+        {
+            iScn_ = iPrevScn;
+            trc_ << boost::format("Rerunpoint: %d task(s) completed, %d partial task(s) and %d task(s) of an older run in %s.")
+                % iNumDone % iNumPartial % iNumCarried % sPath_ << std::endl;
+        }
+        if (iIncremental)
+        {
+            trc_ << boost::format("Rerunpoint: baseline SCN of %d task(s) in %s.")
+                % oBaseline_.size() % sPath_ << std::endl;
+        }
+    }
+    vSave();
+}
+/**
+ * @details
+ */
+bool cManifest::iIsCompleted(const std::string& sKey, tEntry& oEntry)
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    const auto it = oCompleted_.find(sKey);
+    if (it == oCompleted_.end())
+    {
+        return false;
+    }
+    oEntry = it->second;
+    return true;
+}
+/**
+ * @details
+ */
+void cManifest::vStart(const std::string& sKey, const std::string& sFile)
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (sPath_.empty())
+    {
+        return;
+    }
+    // The partial task keeps the baseline, so that the next run starts from there.
+    const auto it = oBaseline_.find(sKey);
+    oEntries_[sKey] = tEntry{false, sFile, 0, 0, 0U, it == oBaseline_.end() ? 0 : it->second, 0};
+    vSave();
+}
+/**
+ * @details
+ */
+void cManifest::vFinish(const std::string& sKey, const tEntry& oEntry)
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (sPath_.empty())
+    {
+        return;
+    }
+    auto& oDone = oEntries_[sKey];
+    oDone = oEntry;
+    oDone.iDone_ = true;
+    std::vector<std::string> oPieces;
+    boost::split(oPieces, oDone.sFile_, boost::is_any_of(szPieceSep));
+    boost::system::error_code ec;
+    oDone.iFileBytes_ = iGetFileBytes(oPieces, ec);
+    vSave();
+}
+/**
+ * @details
+ */
+void cManifest::vSetScn(const int64_t& iScn)
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    iScn_ = iScn;
+    if ( ! sPath_.empty())
+    {
+        vSave();
+    }
+}
+/**
+ * @details
+ */
+int64_t cManifest::iGetScn()
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    return iScn_;
+}
+/**
+ * @details
+ */
+int64_t cManifest::iGetBaseScn(const std::string& sKey)
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    const auto it = oBaseline_.find(sKey);
+    return it == oBaseline_.end() ? 0 : it->second;
+}
+/**
+ * @details
+ */
+void cManifest::vSave()
+{
+    auto sTemp = sPath_;
+    sTemp += ".tmp";
+    {
+        boost::filesystem::ofstream ofs(sTemp, std::ios_base::out | std::ios_base::trunc);
+        if (iScn_)
+        {
+            ofs << szScn << '\t' << iScn_ << '\n';
+        }
+        for (const auto& kv: oEntries_)
+        {
+            ofs << (kv.second.iDone_ ? szDone : szStarted)
+                << '\t' << kv.first
+                << '\t' << kv.second.sFile_
+                << '\t' << kv.second.iNumRows_
+                << '\t' << kv.second.iNumBytes_
+                << '\t' << boost::format("%08x") % kv.second.iCrc32_
+                << '\t' << kv.second.iScn_
+                << '\t' << kv.second.iFileBytes_
+                << '\n';
+        }
+        ofs.flush();
+        ASSERT_OR_RAISE(ofs, std::runtime_error
+            , boost::format("Failed to write %s: %s") % sTemp % ::strerror(errno));
+    }
+    // rename(2) replaces the manifest atomically.
+    boost::filesystem::rename(sTemp, sPath_);
+}
+
+} // ps::lib
+
+} // ps
@@ -0,0 +1,351 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <pslib.h>
+
+namespace ps
+{
+
+namespace lib
+{
+
+/**
+ * @struct cScheduler::tWorker
+ * @brief
+ *   A persistent thread with its own deque of nested tasks.
+ */
+struct cScheduler::tWorker
+{
+    int32_t iId_;
+    std::mutex mtx_;                ///< to protect oDeque_.
+    std::deque<tTask> oDeque_;      ///< The owner uses the back, thieves use the front.
+    std::thread thr_;
+    std::atomic<int64_t> iNumTasks_;
+    std::atomic<int64_t> iNumStolen_;
+    std::atomic<int64_t> iBusyMicroSecs_;
+    std::atomic<int64_t> iIdleMicroSecs_;
+    explicit tWorker(const int32_t& iId)
+        : iId_(iId)
+        , iNumTasks_(0)
+        , iNumStolen_(0)
+        , iBusyMicroSecs_(0)
+        , iIdleMicroSecs_(0)
+    {}
+};
+
+namespace
+{
+
+/// The worker which is running on the current thread. nullptr if it is not a worker.
+thread_local cScheduler::tWorker* oCurrentWorker = nullptr;
+
+int64_t iMicroSecsSince(const std::chrono::steady_clock::time_point& t0)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - t0
+    ).count();
+}
+
+} // ps::lib::<anonymous>
+
+cScheduler::cGroup::cGroup()
+    : iInFlight_(0)
+    , ep_(nullptr)
+{}
+
+cScheduler::cGroup::~cGroup()
+{
+    try
+    {
+        vWaitUntil(0);
+    }
+    catch (...)
+    {
+        // Never throw from the destructor.
+    }
+}
+
+void cScheduler::cGroup::vWaitUntil(const int32_t& iMaxInFlight)
+{
+    auto oSelf = oCurrentWorker;
+    auto& oSched = cScheduler::get_mutable_instance();
+    std::unique_lock<std::mutex> lk(mtx_);
+    while (iInFlight_ > iMaxInFlight)
+    {
+        if (oSelf == nullptr)
+        {
+            evt_.wait(lk);
+            continue;
+        }
+        // Don't sleep while the nested tasks are waiting for a worker,
+        // all workers may be waiting for them.
+        // Only the tasks of this group are run, so that a task of another group,
+        // whichever its priority is, never delays this wait.
+        lk.unlock();
+        tTask oTask;
+        const bool iTaken = oSched.iTake(oSelf, this, oTask);
+        if (iTaken)
+        {
+            ++oSelf->iNumTasks_;
+            vExecute(oTask);
+        }
+        lk.lock();
+        if (! iTaken && iInFlight_ > iMaxInFlight)
+        {
+            // The rest of the tasks are running on the other workers.
+            evt_.wait_for(lk, std::chrono::milliseconds(2));
+        }
+    }
+}
+
+void cScheduler::cGroup::vWait()
+{
+    vWaitUntil(0);
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (ep_)
+    {
+        std::rethrow_exception(ep_);
+    }
+}
+
+bool cScheduler::cGroup::iFailed()
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    return ep_ != nullptr;
+}
+
+cScheduler::cScheduler()
+    : trc_(ps::lib::cTracer::get_mutable_instance())
+    , iSeq_(0)
+    , iStop_(false)
+    , iPending_(0)
+{}
+
+cScheduler::~cScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        iStop_ = true;
+    }
+    evt_.notify_all();
+    for (auto& oWorker: oWorkers_)
+    {
+        if (oWorker->thr_.joinable())
+        {
+            oWorker->thr_.join();
+        }
+    }
+}
+
+void cScheduler::vEnsureWorkers(const int32_t& iNumWorkers)
+{
+    ASSERT_OR_RAISE(iNumWorkers > 0, std::runtime_error
+        , boost::format("iNumWorkers must be greater than zero. Actually %d is given.") % iNumWorkers
+    );
+    std::lock_guard<std::mutex> lk(mtx_);
+    const auto iBefore = static_cast<int32_t>(oWorkers_.size());
+    while (static_cast<int32_t>(oWorkers_.size()) < iNumWorkers)
+    {
+        std::unique_ptr<tWorker> oWorker(new tWorker(static_cast<int32_t>(oWorkers_.size())));
+        oWorker->thr_ = std::thread(&cScheduler::vRun, this, oWorker.get());
+        oWorkers_.push_back(std::move(oWorker));
+    }
+    if (iBefore < iNumWorkers)
+    {
+        trc_ << boost::format("Scheduler: %d -> %d workers") % iBefore % iNumWorkers << std::endl;
+    }
+}
+
+int32_t cScheduler::iGetNumWorkers()
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    return static_cast<int32_t>(oWorkers_.size());
+}
+
+void cScheduler::vSubmit(cGroup& oGroup, tJob fJob, const tPriority& iPriority)
+{
+    {
+        std::lock_guard<std::mutex> lk(oGroup.mtx_);
+        ++oGroup.iInFlight_;
+    }
+    tTask oTask;
+    oTask.fJob_ = std::move(fJob);
+    oTask.oGroup_ = &oGroup;
+    oTask.iPriority_ = iPriority;
+    oTask.iSeq_ = 0;
+    auto oSelf = oCurrentWorker;
+    if (oSelf)
+    {
+        // A nested task is run by this worker or stolen by an idle one.
+        {
+            std::lock_guard<std::mutex> lk(oSelf->mtx_);
+            oSelf->oDeque_.push_back(std::move(oTask));
+        }
+        ++iPending_;
+        // Pass through mtx_ so that an idle worker never misses the notification.
+        std::lock_guard<std::mutex> lk(mtx_);
+    }
+    else
+    {
+        if (iGetNumWorkers() == 0)
+        {
+            vEnsureWorkers(1);
+        }
+        std::lock_guard<std::mutex> lk(mtx_);
+        oTask.iSeq_ = iSeq_++;
+        oGlobal_.push(std::move(oTask));
+        ++iPending_;
+    }
+    evt_.notify_one();
+}
+
+bool cScheduler::iTake(tWorker* oSelf, const cGroup* oOnly, tTask& oTask)
+{
+    if (iPending_.load() == 0)
+    {
+        return false;
+    }
+    const auto iMatch = [oOnly](const tTask& oQueued) {
+        return oOnly == nullptr || oQueued.oGroup_ == oOnly;
+    };
+    if (oSelf)
+    {
+        std::lock_guard<std::mutex> lk(oSelf->mtx_);
+        // The newest one, whose data is likely to be still in the cache.
+        const auto it = std::find_if(oSelf->oDeque_.rbegin(), oSelf->oDeque_.rend(), iMatch);
+        if (it != oSelf->oDeque_.rend())
+        {
+            oTask = std::move(*it);
+            oSelf->oDeque_.erase(std::next(it).base());
+            --iPending_;
+            return true;
+        }
+    }
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (oOnly == nullptr && ! oGlobal_.empty())
+    {
+        oTask = oGlobal_.top();
+        oGlobal_.pop();
+        --iPending_;
+        return true;
+    }
+    // Steal the oldest one from the others in a round-robin manner.
+    const auto iNumWorkers = oWorkers_.size();
+    const size_t iStart = oSelf ? oSelf->iId_ + 1 : 0;
+    for (size_t i = 0; i < iNumWorkers; ++i)
+    {
+        auto& oVictim = *oWorkers_[(iStart + i) % iNumWorkers];
+        if (&oVictim == oSelf)
+        {
+            continue;
+        }
+        std::lock_guard<std::mutex> lkVictim(oVictim.mtx_);
+        const auto it = std::find_if(oVictim.oDeque_.begin(), oVictim.oDeque_.end(), iMatch);
+        if (it != oVictim.oDeque_.end())
+        {
+            oTask = std::move(*it);
+            oVictim.oDeque_.erase(it);
+            --iPending_;
+            if (oSelf)
+            {
+                ++oSelf->iNumStolen_;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void cScheduler::vExecute(tTask& oTask)
+{
+    std::exception_ptr ep = nullptr;
+    try
+    {
+        oTask.fJob_();
+    }
+    catch (...)
+    {
+        ep = std::current_exception();
+    }
+    // Release the captured resources before the waiting thread is released.
+    oTask.fJob_ = nullptr;
+    auto& oGroup = *oTask.oGroup_;
+    std::lock_guard<std::mutex> lk(oGroup.mtx_);
+    // It would be sufficient if we could only distinguish one exception
+    // which is caught earliest.
+    if (ep && oGroup.ep_ == nullptr)
+    {
+        oGroup.ep_ = ep;
+    }
+    --oGroup.iInFlight_;
+    // Notify while locking, the group may be destructed as soon as it is unlocked.
+    oGroup.evt_.notify_all();
+}
+
+void cScheduler::vRun(tWorker* oSelf)
+{
+    oCurrentWorker = oSelf;
+    for (;;)
+    {
+        tTask oTask;
+        if (iTake(oSelf, nullptr, oTask))
+        {
+            const auto t0 = std::chrono::steady_clock::now();
+            ++oSelf->iNumTasks_;
+            vExecute(oTask);
+            oSelf->iBusyMicroSecs_ += iMicroSecsSince(t0);
+            continue;
+        }
+        const auto t0 = std::chrono::steady_clock::now();
+        std::unique_lock<std::mutex> lk(mtx_);
+        evt_.wait(lk, [this]{ return iStop_ || iPending_.load() > 0; });
+        oSelf->iIdleMicroSecs_ += iMicroSecsSince(t0);
+        if (iStop_ && iPending_.load() == 0)
+        {
+            break;
+        }
+    }
+}
+
+void cScheduler::vTraceStats()
+{
+    if (oCurrentWorker)
+    {
+        return; // Only the outermost caller reports.
+    }
+    std::lock_guard<std::mutex> lk(mtx_);
+    for (const auto& oWorker: oWorkers_)
+    {
+        trc_ << boost::format(
+            "Scheduler: worker %2d: tasks=%d, stolen=%d, busy=%.3f sec, idle=%.3f sec"
+        )
+            % oWorker->iId_
+            % oWorker->iNumTasks_.load() % oWorker->iNumStolen_.load()
+            % (oWorker->iBusyMicroSecs_.load() / 1e6)
+            % (oWorker->iIdleMicroSecs_.load() / 1e6)
+            << std::endl;
+    }
+}
+
+} // ps::lib
+
+} // ps
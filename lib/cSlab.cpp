@@ -0,0 +1,94 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <pslib.h>
+
+namespace ps
+{
+
+namespace lib
+{
+
+cSlab::cSlab(const size_t& iCapacity)
+    : buf_(iCapacity ? new char[iCapacity] : nullptr)
+    , iSize_(0)
+    , iCapacity_(iCapacity)
+{}
+
+cSlab::cSlab(cSlab&& rhs)
+    : buf_(std::move(rhs.buf_))
+    , iSize_(rhs.iSize_)
+    , iCapacity_(rhs.iCapacity_)
+{
+    rhs.iSize_ = 0;
+    rhs.iCapacity_ = 0;
+}
+
+void cSlab::vGrow(const size_t& iRequired)
+{
+    auto iCapacity = iCapacity_ ? iCapacity_ : size_t(4096);
+    while (iCapacity < iRequired)
+    {
+        iCapacity *= 2;
+    }
+    std::unique_ptr<char[]> buf(new char[iCapacity]);
+    if (iSize_)
+    {
+        ::memcpy(buf.get(), buf_.get(), iSize_);
+    }
+    buf_.swap(buf);
+    iCapacity_ = iCapacity;
+}
+
+void cSlab::vPatchDecimal(const size_t& iOffset, const int32_t& iWidth, size_t iValue)
+{
+    BOOST_ASSERT(iWidth >= 0);
+    BOOST_ASSERT(iOffset + iWidth <= iSize_);
+    char digits[24];
+    int32_t iNumDigits = 0;
+    do
+    {
+        digits[iNumDigits++] = '0' + iValue % 10;
+        iValue /= 10;
+    } while (iValue);
+    if (iNumDigits > iWidth)
+    {
+        // Making room for the extra digits.
+        const auto iExtra = static_cast<size_t>(iNumDigits - iWidth);
+        const auto iTail = iSize_ - (iOffset + iWidth);
+        szReserve(iExtra);
+        char* p = buf_.get() + iOffset + iWidth;
+        ::memmove(p + iExtra, p, iTail);
+    }
+    char* p = buf_.get() + iOffset;
+    for (auto i = iNumDigits; i < iWidth; ++i)
+    {
+        *p++ = '0';
+    }
+    while (iNumDigits)
+    {
+        *p++ = digits[--iNumDigits];
+    }
+}
+
+} // ps::lib
+
+} // ps
@@ -0,0 +1,256 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <pslib.h>
+
+namespace ps
+{
+
+namespace lib
+{
+
+cSlabWriter::cSlabWriter(std::ostream& os, const size_t& iCapacity, const std::string& tag)
+    : trc_(ps::lib::cTracer::get_mutable_instance())
+    , os_(&os)
+    , tag_(tag)
+    , iCapacity_(iCapacity)
+    , iClosed_(false)
+    , ep_(nullptr)
+    , iMaxDepth_(0)
+    , iBytesInFlight_(0)
+    , iMaxBytesInFlight_(0)
+    , iNumStalls_(0)
+    , iStallMicroSecs_(0)
+    , iBytesWritten_(0)
+    , iWriteMicroSecs_(0)
+    , iNumSpills_(0)
+    , iPieceBytes_(0)
+    , iBytesInPiece_(0)
+    , iRollPending_(false)
+{
+    ASSERT_OR_RAISE(iCapacity_ > 0, std::runtime_error
+        , boost::format("iCapacity must be greater than zero. Actually %d is given.") % iCapacity_
+    );
+    thr_ = std::thread(&cSlabWriter::vRun, this);
+}
+
+cSlabWriter::~cSlabWriter()
+{
+    try
+    {
+        vClose();
+    }
+    catch (...)
+    {
+        // The exception has already been propagated by vPush or vClose.
+    }
+}
+
+void cSlabWriter::vRun()
+{
+    for (;;)
+    {
+        tSlabPtr oSlab;
+        bool iRowEnd = false;
+        {
+            std::unique_lock<std::mutex> lk(mtx_);
+            evtFilled_.wait(lk, [this]{ return ! oFilled_.empty() || iClosed_; });
+            if (oFilled_.empty())
+            {
+                break; // Closed and drained.
+            }
+            oSlab = std::move(oFilled_.front().first);
+            iRowEnd = oFilled_.front().second;
+            oFilled_.pop_front();
+        }
+        const auto iBytes = static_cast<int64_t>(oSlab->size());
+        try
+        {
+            if (ep_ == nullptr)
+            {
+                if (iRollPending_ && iBytes)
+                {
+                    // Rolled only when there are more bytes, so that no empty piece is left.
+                    os_ = &oRoller_();
+                    iBytesInPiece_ = 0;
+                    iRollPending_ = false;
+                }
+                const auto tBgn = std::chrono::steady_clock::now();
+                os_->write(oSlab->data(), oSlab->size());
+                ASSERT_OR_RAISE(*os_, std::runtime_error, ::strerror(errno));
+                const auto iMicroSecs = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - tBgn
+                ).count();
+                iWriteMicroSecs_ += iMicroSecs;
+                if (oMeter_)
+                {
+                    oMeter_(iBytes, iMicroSecs);
+                }
+                iBytesWritten_ += iBytes;
+                iBytesInPiece_ += iBytes;
+                oCrc_.process_bytes(oSlab->data(), oSlab->size());
+                iRollPending_ = iPieceBytes_ > 0 && iRowEnd && iBytesInPiece_ >= iPieceBytes_;
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lk(mtx_);
+            ep_ = std::current_exception();
+        }
+        oSlab->vClear();
+        {
+            std::lock_guard<std::mutex> lk(mtx_);
+            iBytesInFlight_ -= iBytes;
+            oEmptied_.push(std::move(oSlab));
+        }
+        evtEmptied_.notify_all();
+    }
+}
+
+void cSlabWriter::vEnqueue(tSlabPtr& oSlab, const bool& iKeepOwnership)
+{
+    BOOST_ASSERT(oSlab);
+    const auto tid = std::this_thread::get_id();
+    std::unique_lock<std::mutex> lk(mtx_);
+    auto iReady = [this, &tid]{
+        return (oFilled_.size() < iCapacity_
+            && (oOwner_ == std::thread::id() || oOwner_ == tid)) || ep_;
+    };
+    if (! iReady())
+    {
+        const auto tBgn = std::chrono::steady_clock::now();
+        evtEmptied_.wait(lk, iReady);
+        ++iNumStalls_;
+        iStallMicroSecs_ += std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - tBgn
+        ).count();
+    }
+    ASSERT_OR_RAISE(ep_ == nullptr, std::runtime_error
+        , boost::format("%s; The writer has stopped by an error.") % tag_
+    );
+    iBytesInFlight_ += oSlab->size();
+    iMaxBytesInFlight_ = std::max(iMaxBytesInFlight_, iBytesInFlight_);
+    // A slab which is not spilled ends with a whole row.
+    oFilled_.emplace_back(std::move(oSlab), ! iKeepOwnership);
+    iMaxDepth_ = std::max(iMaxDepth_, oFilled_.size());
+    if (oEmptied_.empty())
+    {
+        oSlab.reset(new ps::lib::cSlab);
+    }
+    else
+    {
+        oSlab = std::move(oEmptied_.top());
+        oEmptied_.pop();
+    }
+    const bool iReleased = ! iKeepOwnership && oOwner_ == tid;
+    if (iKeepOwnership)
+    {
+        oOwner_ = tid;
+    }
+    else if (iReleased)
+    {
+        oOwner_ = std::thread::id();
+    }
+    lk.unlock();
+    evtFilled_.notify_one();
+    if (iReleased)
+    {
+        evtEmptied_.notify_all();
+    }
+}
+
+void cSlabWriter::vSetRolling(const int64_t& iPieceBytes, tRoller oRoller)
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    BOOST_ASSERT(iBytesWritten_ == 0 && oFilled_.empty());
+    iPieceBytes_ = iPieceBytes;
+    oRoller_ = oRoller;
+}
+
+void cSlabWriter::vSetMeter(tMeter oMeter)
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    BOOST_ASSERT(iBytesWritten_ == 0 && oFilled_.empty());
+    oMeter_ = oMeter;
+}
+
+void cSlabWriter::vPush(tSlabPtr& oSlab)
+{
+    vEnqueue(oSlab, false);
+}
+
+void cSlabWriter::vSpill(ps::lib::cSlab& oSlab)
+{
+    tSlabPtr oFilled(new ps::lib::cSlab);
+    oFilled->swap(oSlab);
+    vEnqueue(oFilled, true);
+    // An emptied slab, recycled if possible, is given back to the caller.
+    oSlab.swap(*oFilled);
+    ++iNumSpills_;
+}
+
+void cSlabWriter::vRelease()
+{
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        if (oOwner_ != std::this_thread::get_id())
+        {
+            return;
+        }
+        oOwner_ = std::thread::id();
+    }
+    evtEmptied_.notify_all();
+}
+
+void cSlabWriter::vClose()
+{
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        if (iClosed_)
+        {
+            return;
+        }
+        iClosed_ = true;
+    }
+    evtFilled_.notify_one();
+    if (thr_.joinable())
+    {
+        thr_.join();
+    }
+    trc_ << boost::format(
+        "%s; Writer: depth max=%d/%d, stalls=%d (%.3f sec), "
+        "in flight max=%s Bytes, written=%s Bytes (%.3f sec), spills=%d")
+        % tag_ % iMaxDepth_ % iCapacity_
+        % iNumStalls_ % (iStallMicroSecs_ / 1000000.0)
+        % ps::lib::sBinIntToIntStr(iMaxBytesInFlight_)
+        % ps::lib::sBinIntToIntStr(iBytesWritten_)
+        % (iWriteMicroSecs_ / 1000000.0)
+        % iNumSpills_
+        << std::endl;
+    if (ep_)
+    {
+        std::rethrow_exception(ep_);
+    }
+}
+
+} // ps::lib
+
+} // ps
@@ -31,6 +31,9 @@ namespace lib
  */
 cStat::cStat()
     : iOutputBytes_(0)
+    , iEstimatedBytes_(0)
+    , iSettledEstimate_(0)
+    , iSettledActual_(0)
     , time_at_started_(boost::posix_time::microsec_clock::local_time())
 {}
 /**
@@ -59,6 +62,53 @@ int32_t cStat::iDurationMilliSeconds() const
     const boost::posix_time::time_duration duration = period.length();
     return duration.total_milliseconds();
 }
+/**
+ * @details
+ */
+void cStat::vAddEstimatedBytes(const int64_t& iEstimatedBytes)
+{
+    iEstimatedBytes_ += iEstimatedBytes;
+}
+/**
+ * @details
+ */
+void cStat::vSettleEstimate(const int64_t& iEstimatedBytes, const int64_t& iActualBytes)
+{
+    if (iEstimatedBytes > 0)
+    {
+        iSettledEstimate_ += iEstimatedBytes;
+        iSettledActual_ += iActualBytes;
+    }
+}
+/**
+ * @details
+ * - The estimation comes from the statistics of the segments,
+ *   so that it is scaled by the ratio of the actual output
+ *   of the finished tasks to their estimation.
+ * - The remaining time assumes the average data rate since started.
+ */
+std::string cStat::sGetEta() const
+{
+    const auto iEstimated = iEstimatedBytes_.load();
+    const auto iOutput = iOutputBytes_.load();
+    const auto iMiSec = iDurationMilliSeconds();
+    if (iEstimated <= 0 || iOutput <= 0 || iMiSec <= 0)
+    {
+        return "";
+    }
+    const auto iSettledEstimate = iSettledEstimate_.load();
+    const double fScale = iSettledEstimate > 0
+        ? static_cast<double>(iSettledActual_.load()) / iSettledEstimate
+        : 1.0;
+    const auto fTotal = std::max(iEstimated * fScale, static_cast<double>(iOutput));
+    const auto iRestSecs = static_cast<int64_t>(
+        (fTotal - iOutput) * iMiSec / iOutput / 1000
+    );
+    return (boost::format(" ETA %02d:%02d:%02d (%d%%)")
+        % (iRestSecs / 3600) % (iRestSecs / 60 % 60) % (iRestSecs % 60)
+        % static_cast<int32_t>(iOutput * 100 / fTotal)
+    ).str();
+}
 
 /**
  * @details
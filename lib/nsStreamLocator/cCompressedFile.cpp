@@ -0,0 +1,359 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <pslib.h>
+
+namespace ps
+{
+namespace lib
+{
+namespace nsStreamLocator
+{
+
+namespace
+{
+
+/**
+ * @brief
+ * Threads which compress the frames of all instances of cCompressedFile.
+ * The pool is created by the first frame, with the number of threads given at that time.
+ */
+ps::lib::cTaskPool<std::string>& oGetFramePool()
+{
+    static ps::lib::cTaskPool<std::string> oPool(iCompressThreads_);
+    return oPool;
+}
+
+/// @return One gzip member, which can be concatenated with the others.
+std::string sCompressGzip(const std::string& sFrame, const int32_t& iLevel)
+{
+    z_stream zs;
+    std::memset(&zs, 0, sizeof(zs));
+    // 16 is added to the window bits to write the gzip header and trailer.
+    ASSERT_OR_RAISE(
+        Z_OK == ::deflateInit2(&zs, iLevel ? iLevel : Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY)
+        , std::runtime_error, "Failed to initialize deflate."
+    );
+    BOOST_SCOPE_EXIT(&zs)
+    {
+        ::deflateEnd(&zs);
+    }
+    BOOST_SCOPE_EXIT_END;
+    std::string sOut(::deflateBound(&zs, sFrame.size()) + 32, '\0');
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(sFrame.data()));
+    zs.avail_in = static_cast<uInt>(sFrame.size());
+    zs.next_out = reinterpret_cast<Bytef*>(&sOut[0]);
+    zs.avail_out = static_cast<uInt>(sOut.size());
+    const auto rc = ::deflate(&zs, Z_FINISH);
+    ASSERT_OR_RAISE(rc == Z_STREAM_END, std::runtime_error
+        , boost::format("Failed to deflate. rc=%d") % rc);
+    sOut.resize(zs.total_out);
+    return sOut;
+}
+
+#ifdef PS_HAVE_ZSTD
+/// @return One zstd frame.
+std::string sCompressZstd(const std::string& sFrame, const int32_t& iLevel)
+{
+    std::string sOut(::ZSTD_compressBound(sFrame.size()), '\0');
+    const auto rc = ::ZSTD_compress(&sOut[0], sOut.size(), sFrame.data(), sFrame.size()
+        , iLevel ? iLevel : ZSTD_CLEVEL_DEFAULT);
+    ASSERT_OR_RAISE(! ::ZSTD_isError(rc), std::runtime_error
+        , boost::format("Failed to compress by zstd. %s") % ::ZSTD_getErrorName(rc));
+    sOut.resize(rc);
+    return sOut;
+}
+#endif
+
+#ifdef PS_HAVE_LZ4
+/// @return One lz4 frame.
+std::string sCompressLz4(const std::string& sFrame, const int32_t& iLevel)
+{
+    LZ4F_preferences_t oPrefs;
+    std::memset(&oPrefs, 0, sizeof(oPrefs));
+    oPrefs.compressionLevel = iLevel;
+    oPrefs.frameInfo.contentSize = sFrame.size();
+    std::string sOut(::LZ4F_compressFrameBound(sFrame.size(), &oPrefs), '\0');
+    const auto rc = ::LZ4F_compressFrame(&sOut[0], sOut.size(), sFrame.data(), sFrame.size(), &oPrefs);
+    ASSERT_OR_RAISE(! ::LZ4F_isError(rc), std::runtime_error
+        , boost::format("Failed to compress by lz4. %s") % ::LZ4F_getErrorName(rc));
+    sOut.resize(rc);
+    return sOut;
+}
+#endif
+
+std::string sCompress(const cCompressedFile::tCodec& iCodec, const std::string& sFrame, const int32_t& iLevel)
+{
+    switch (iCodec)
+    {
+    case cCompressedFile::iGzip:
+        return sCompressGzip(sFrame, iLevel);
+#ifdef PS_HAVE_ZSTD
+    case cCompressedFile::iZstd:
+        return sCompressZstd(sFrame, iLevel);
+#endif
+#ifdef PS_HAVE_LZ4
+    case cCompressedFile::iLz4:
+        return sCompressLz4(sFrame, iLevel);
+#endif
+    default:
+        RAISE_EX_CONVERT(std::runtime_error
+            , boost::format("The codec %d is not built in.") % iCodec);
+    }
+}
+
+} // anonymous
+
+/**
+ * @class cFrameCompressor
+ * @brief
+ * A boost::iostreams output filter which cuts the bytes into frames,
+ * and writes the frames compressed by oGetFramePool() in order.
+ * The copies share one state, because the filter is copied into the chain.
+ * flush() finishes the partial frame, so that the frames are cut there.
+ */
+class cFrameCompressor
+{
+public:
+    typedef char char_type;
+    struct category
+        : boost::iostreams::multichar_output_filter_tag
+        , boost::iostreams::closable_tag
+        , boost::iostreams::flushable_tag
+    {};
+    cFrameCompressor(
+        const std::string& sName
+        , const cCompressedFile::tCodec& iCodec
+        , const int32_t& iLevel
+        , const int64_t& iFrameBytes
+    )
+        : oState_(new tState(sName, iCodec, iLevel, iFrameBytes))
+    {}
+    template<typename Sink>
+    std::streamsize write(Sink& snk, const char_type* s, std::streamsize n)
+    {
+        auto& st = *oState_;
+        for (auto iRest = n; iRest > 0; )
+        {
+            const auto iCopy = std::min<std::streamsize>(iRest, st.iFrameBytes_ - st.sFrame_.size());
+            st.sFrame_.append(s, iCopy);
+            s += iCopy;
+            iRest -= iCopy;
+            if (static_cast<int64_t>(st.sFrame_.size()) >= st.iFrameBytes_)
+            {
+                vSubmit();
+            }
+            vDrain(snk, false);
+        }
+        return n;
+    }
+    template<typename Sink>
+    bool flush(Sink& snk)
+    {
+        vFinish(snk);
+        return true;
+    }
+    template<typename Sink>
+    void close(Sink& snk)
+    {
+        auto& st = *oState_;
+        vFinish(snk);
+        st.trc_ << boost::format("%s; Compressed %s Bytes into %s Bytes (ratio %.2f) by %d frame(s).")
+            % st.sName_
+            % ps::lib::sBinIntToIntStr(st.iRawBytes_)
+            % ps::lib::sBinIntToIntStr(st.iCompressedBytes_)
+            % (st.iCompressedBytes_ ? static_cast<double>(st.iRawBytes_) / st.iCompressedBytes_ : 0.0)
+            % st.iNumFrames_
+            << std::endl;
+    }
+private:
+    struct tState
+    {
+        ps::lib::cTracer& trc_;
+        const std::string sName_;
+        const cCompressedFile::tCodec iCodec_;
+        const int32_t iLevel_;
+        const int64_t iFrameBytes_;
+        std::string sFrame_;                            ///< A frame being filled.
+        std::deque<std::future<std::string>> oPending_; ///< Frames being compressed, in order.
+        int64_t iRawBytes_;
+        int64_t iCompressedBytes_;
+        int64_t iNumFrames_;
+        tState(
+            const std::string& sName
+            , const cCompressedFile::tCodec& iCodec
+            , const int32_t& iLevel
+            , const int64_t& iFrameBytes
+        )
+            : trc_(ps::lib::cTracer::get_mutable_instance())
+            , sName_(sName)
+            , iCodec_(iCodec)
+            , iLevel_(iLevel)
+            , iFrameBytes_(iFrameBytes)
+            , iRawBytes_(0)
+            , iCompressedBytes_(0)
+            , iNumFrames_(0)
+        {
+            sFrame_.reserve(iFrameBytes_);
+        }
+    };
+    std::shared_ptr<tState> oState_;
+    void vSubmit()
+    {
+        auto& st = *oState_;
+        auto sFrame = std::make_shared<std::string>();
+        sFrame->swap(st.sFrame_);
+        st.sFrame_.reserve(st.iFrameBytes_);
+        st.iRawBytes_ += sFrame->size();
+        const auto iCodec = st.iCodec_;
+        const auto iLevel = st.iLevel_;
+        st.oPending_.push_back(oGetFramePool().oSubmit(
+            [iCodec, iLevel, sFrame]{ return sCompress(iCodec, *sFrame, iLevel); }
+        ));
+    }
+    /// @brief Compresses the partial frame and writes all frames pending.
+    template<typename Sink>
+    void vFinish(Sink& snk)
+    {
+        auto& st = *oState_;
+        // An empty file is not a valid stream for the decoders, so one empty frame is written.
+        if (st.sFrame_.size() || (st.iNumFrames_ == 0 && st.oPending_.empty()))
+        {
+            vSubmit();
+        }
+        vDrain(snk, true);
+    }
+    /**
+     * @brief
+     *   Writes the frames compressed from the oldest. The caller waits
+     *   only if too many frames are pending, or iAll is true.
+     */
+    template<typename Sink>
+    void vDrain(Sink& snk, const bool& iAll)
+    {
+        auto& st = *oState_;
+        const auto iMaxPending = oGetFramePool().iGetNumThreads() * 2;
+        while (st.oPending_.size()
+            && (iAll
+                || st.oPending_.size() > iMaxPending
+                || st.oPending_.front().wait_for(std::chrono::seconds(0)) == std::future_status::ready
+            )
+        ){
+            const auto sOut = st.oPending_.front().get();
+            st.oPending_.pop_front();
+            boost::iostreams::write(snk, sOut.data(), sOut.size());
+            st.iCompressedBytes_ += sOut.size();
+            ++st.iNumFrames_;
+        }
+    }
+};
+
+/**
+ * @class cCompressedFileImpl
+ * @brief
+ */
+class cCompressedFileImpl
+    : public boost::iostreams::filtering_ostreambuf
+{
+public:
+    cCompressedFileImpl(
+        const std::string& sName
+        , const cCompressedFile::tCodec& iCodec
+        , const int32_t& iLevel
+        , const int64_t& iFrameBytes
+    );
+    ~cCompressedFileImpl();
+protected:
+    /**
+     * @brief
+     * Writes the frames pending and flushes the file,
+     * so that flush() reports an error of any of them by the badbit.
+     * @return -1 if it failed.
+     */
+    int sync() override;
+private:
+    /// @brief Object for trace output.
+    ps::lib::cTracer& trc_;
+    /// @brief The file which the compressed frames are written to.
+    std::unique_ptr<cFileSystem> oFile_;
+};
+
+cCompressedFileImpl::cCompressedFileImpl(
+    const std::string& sName
+    , const cCompressedFile::tCodec& iCodec
+    , const int32_t& iLevel
+    , const int64_t& iFrameBytes
+)
+    : trc_(ps::lib::cTracer::get_mutable_instance())
+    , oFile_(new cFileSystem(sName))
+{
+    ASSERT_OR_RAISE(iFrameBytes > 0, std::runtime_error
+        , boost::format("The frame size must be greater than zero. Actually %d.") % iFrameBytes);
+    this->push(cFrameCompressor(sName, iCodec, iLevel, iFrameBytes));
+    this->push(*oFile_);
+}
+
+cCompressedFileImpl::~cCompressedFileImpl()
+{
+    try
+    {
+        // The rest of the frames are written before the file is closed.
+        this->reset();
+        oFile_->flush();
+    }
+    catch (const std::exception& e)
+    {
+        trc_ << boost::format("cCompressedFile failed to close: %s") % e.what() << std::endl;
+    }
+}
+
+int cCompressedFileImpl::sync()
+{
+    // The chain catches the exception of the filter, and returns -1.
+    if (boost::iostreams::filtering_ostreambuf::sync() != 0)
+    {
+        trc_ << boost::format("cCompressedFile failed to write the frames.") << std::endl;
+        return -1;
+    }
+    oFile_->flush();
+    return *oFile_ ? 0 : -1;
+}
+
+/**
+ * works to mediate between the interface and the implementation.
+ */
+cCompressedFile::cCompressedFile(
+    const std::string& sName
+    , const tCodec& iCodec
+    , const int32_t& iLevel
+    , const int64_t& iFrameBytes
+)
+     : oImpl_(new cCompressedFileImpl(sName, iCodec, iLevel, iFrameBytes)
+    , vRegularDeleter<cCompressedFileImpl>)
+{
+    this->rdbuf(oImpl_.get());
+}
+
+} // ps::lib::nsStreamLocator
+
+} // ps::lib
+
+} // ps
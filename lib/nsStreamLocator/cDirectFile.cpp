@@ -0,0 +1,390 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <pslib.h>
+
+namespace ps
+{
+namespace lib
+{
+namespace nsStreamLocator
+{
+
+namespace
+{
+
+/// @brief Alignment of the address, the offset and the length of a write with O_DIRECT.
+const size_t iAlignment = 4096;
+
+size_t iAlignUp(const size_t& iBytes, const size_t& iAlign)
+{
+    return (iBytes + iAlign - 1) / iAlign * iAlign;
+}
+
+/**
+ * @brief
+ * Threads which call pwrite for all instances of cDirectFile, when io_uring is not used.
+ * The pool is created by the first write, with the queue depth given at that time.
+ */
+ps::lib::cTaskPool<void>& oGetWritePool()
+{
+    static ps::lib::cTaskPool<void> oPool(iDirectQueueDepth_);
+    return oPool;
+}
+
+/// @brief Writes all bytes, resuming a short write.
+void vWriteFully(const int& fd, const char* pData, size_t iLength, off_t iOffset)
+{
+    while (iLength > 0)
+    {
+        const auto rc = ::pwrite(fd, pData, iLength, iOffset);
+        if (rc < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        ASSERT_OR_RAISE(rc > 0, std::runtime_error
+            , boost::format("Failed to write. %s") % ::strerror(rc < 0 ? errno : EIO));
+        pData += rc;
+        iLength -= rc;
+        iOffset += rc;
+    }
+}
+
+} // anonymous
+
+/**
+ * @class cDirectFileImpl
+ * @brief
+ * The put area is one of the buffers. When it is full, it is submitted,
+ * and the next buffer in the ring becomes the put area after its previous write completed.
+ */
+class cDirectFileImpl
+    : public std::streambuf
+{
+public:
+    cDirectFileImpl(const std::string& sName, const int64_t& iBufferBytes, const int32_t& iQueueDepth);
+    ~cDirectFileImpl();
+protected:
+    int_type overflow(int_type ch) override;
+    /**
+     * @brief
+     * Waits for the writes in flight and writes the put area, padded but not consumed,
+     * so that flush() reports an error of any write by the badbit.
+     * @return -1 if a write failed.
+     */
+    int sync() override;
+private:
+    struct tBuffer
+    {
+        tBuffer() : oData_(nullptr, ::free), iBusy_(false), iLength_(0), iOffset_(0) {}
+        std::unique_ptr<char, void(*)(void*)> oData_;
+        std::future<void> oDone_;   ///< Completion of pwrite on the pool.
+        bool iBusy_;                ///< true while the write is in flight.
+        size_t iLength_;
+        off_t iOffset_;
+    };
+    /// @brief Object for trace output.
+    ps::lib::cTracer& trc_;
+    /// @brief Output destination file name.
+    boost::filesystem::path name_;
+    int fd_;
+    /// @brief false means that the file system refused O_DIRECT.
+    bool iDirect_;
+    size_t iBufferBytes_;
+    std::vector<tBuffer> oBuffers_;
+    /// @brief Index of the buffer which is the put area.
+    size_t iCurrent_;
+    /// @brief File offset of the put area.
+    off_t iOffset_;
+    /// @brief Bytes of the put area which have been written by sync().
+    size_t iSynced_;
+    int64_t iNumWrites_;
+#ifdef PS_HAVE_LIBURING
+    struct io_uring oRing_;
+    /// @brief false means falling back to oGetWritePool().
+    bool iUring_;
+#endif
+    void vSubmit(const size_t& iIndex, const size_t& iLength);
+    void vWait(const size_t& iIndex);
+    void vClose();
+};
+
+cDirectFileImpl::cDirectFileImpl(
+    const std::string& sName
+    , const int64_t& iBufferBytes
+    , const int32_t& iQueueDepth
+)
+    : trc_(ps::lib::cTracer::get_mutable_instance())
+    , name_(sName)
+    , fd_(-1)
+    , iDirect_(true)
+    , iBufferBytes_(iAlignUp(std::max<int64_t>(iBufferBytes, 1), iAlignment))
+    , oBuffers_(std::max(iQueueDepth, 1))
+    , iCurrent_(0)
+    , iOffset_(0)
+    , iSynced_(0)
+    , iNumWrites_(0)
+#ifdef PS_HAVE_LIBURING
+    , iUring_(false)
+#endif
+{
+    boost::filesystem::path sParentPath(name_.parent_path());
+    boost::system::error_code ec;
+    boost::filesystem::exists(sParentPath, ec);
+    ASSERT_OR_RAISE(
+        !ec
+        , std::runtime_error
+        , boost::format("%s: specified %s") % ec.message() % sParentPath
+    );
+    for (auto& oBuffer: oBuffers_)
+    {
+        void* pData = nullptr;
+        ASSERT_OR_RAISE(0 == ::posix_memalign(&pData, iAlignment, iBufferBytes_)
+            , std::runtime_error, boost::format("Failed to allocate %d bytes.") % iBufferBytes_);
+        oBuffer.oData_.reset(static_cast<char*>(pData));
+    }
+    fd_ = ::open(name_.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC | O_DIRECT, 0666);
+    if (fd_ < 0 && errno == EINVAL)
+    {
+        // e.g. tmpfs does not support O_DIRECT.
+        iDirect_ = false;
+        fd_ = ::open(name_.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+    }
+    ASSERT_OR_RAISE(fd_ >= 0, std::runtime_error
+        , boost::format("Failed to open %s. %s") % name_ % ::strerror(errno));
+#ifdef PS_HAVE_LIBURING
+    iUring_ = 0 == ::io_uring_queue_init(oBuffers_.size(), &oRing_, 0);
+#endif
+    this->setp(oBuffers_[iCurrent_].oData_.get(), oBuffers_[iCurrent_].oData_.get() + iBufferBytes_);
+    trc_ << boost::format("cDirectFile is opend: %s (O_DIRECT=%s, buffer=%d, depth=%d)")
+        % name_ % (iDirect_ ? "on" : "off") % iBufferBytes_ % oBuffers_.size() << std::endl;
+}
+
+cDirectFileImpl::~cDirectFileImpl()
+{
+    try
+    {
+        this->vClose();
+        trc_ << boost::format("cDirectFile is closed:%s (%d bytes by %d writes)")
+            % name_ % iOffset_ % iNumWrites_ << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+        trc_ << boost::format("cDirectFile failed to close %s. %s") % name_ % e.what() << std::endl;
+    }
+}
+
+cDirectFileImpl::int_type cDirectFileImpl::overflow(int_type ch)
+{
+    this->vSubmit(iCurrent_, iBufferBytes_);
+    iCurrent_ = (iCurrent_ + 1) % oBuffers_.size();
+    // The next one in the ring is the oldest in flight.
+    this->vWait(iCurrent_);
+    auto pData = oBuffers_[iCurrent_].oData_.get();
+    this->setp(pData, pData + iBufferBytes_);
+    iSynced_ = 0;
+    if ( ! traits_type::eq_int_type(ch, traits_type::eof()))
+    {
+        *this->pptr() = traits_type::to_char_type(ch);
+        this->pbump(1);
+    }
+    return traits_type::not_eof(ch);
+}
+
+int cDirectFileImpl::sync()
+{
+    try
+    {
+        for (size_t i = 0; i < oBuffers_.size(); ++i)
+        {
+            this->vWait(i);
+        }
+        const size_t iTail = this->pptr() - this->pbase();
+        if (iTail != iSynced_)
+        {
+            // The put area stays at the same offset, and it is written again when it is full.
+            const auto iPadded = iAlignUp(iTail, iDirect_ ? iAlignment : 1);
+            std::memset(this->pptr(), 0, iPadded - iTail);
+            vWriteFully(fd_, this->pbase(), iPadded, iOffset_);
+            ++iNumWrites_;
+            ASSERT_OR_RAISE(iPadded == iTail || ::ftruncate(fd_, iOffset_ + iTail) == 0
+                , std::runtime_error
+                , boost::format("Failed to truncate %s. %s") % name_ % ::strerror(errno));
+            iSynced_ = iTail;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        trc_ << boost::format("cDirectFile failed to write %s. %s") % name_ % e.what() << std::endl;
+        return -1;
+    }
+    return 0;
+}
+
+void cDirectFileImpl::vSubmit(const size_t& iIndex, const size_t& iLength)
+{
+    auto& oBuffer = oBuffers_[iIndex];
+    oBuffer.iLength_ = iLength;
+    oBuffer.iOffset_ = iOffset_;
+    iOffset_ += iLength;
+    ++iNumWrites_;
+#ifdef PS_HAVE_LIBURING
+    if (iUring_)
+    {
+        // The number of entries equals to the number of buffers.
+        auto sqe = ::io_uring_get_sqe(&oRing_);
+        ASSERT_OR_RAISE(sqe, std::runtime_error, "io_uring submission queue is full.");
+        ::io_uring_prep_write(sqe, fd_, oBuffer.oData_.get(), iLength, oBuffer.iOffset_);
+        ::io_uring_sqe_set_data(sqe, &oBuffer);
+        const auto rc = ::io_uring_submit(&oRing_);
+        ASSERT_OR_RAISE(rc >= 0, std::runtime_error
+            , boost::format("Failed to submit to io_uring. %s") % ::strerror(-rc));
+        oBuffer.iBusy_ = true;
+        return;
+    }
+#endif
+    const auto fd = fd_;
+    const auto pData = oBuffer.oData_.get();
+    const auto iOffset = oBuffer.iOffset_;
+    oBuffer.oDone_ = oGetWritePool().oSubmit([fd, pData, iLength, iOffset]{
+        vWriteFully(fd, pData, iLength, iOffset);
+    });
+    oBuffer.iBusy_ = true;
+}
+
+void cDirectFileImpl::vWait(const size_t& iIndex)
+{
+    auto& oBuffer = oBuffers_[iIndex];
+#ifdef PS_HAVE_LIBURING
+    if (iUring_)
+    {
+        // The completions may come in any order.
+        while (oBuffer.iBusy_)
+        {
+            struct io_uring_cqe* cqe = nullptr;
+            const auto rc = ::io_uring_wait_cqe(&oRing_, &cqe);
+            if (rc == -EINTR)
+            {
+                continue;
+            }
+            ASSERT_OR_RAISE(rc == 0, std::runtime_error
+                , boost::format("Failed to wait for io_uring. %s") % ::strerror(-rc));
+            auto& oDone = *static_cast<tBuffer*>(::io_uring_cqe_get_data(cqe));
+            const auto res = cqe->res;
+            ::io_uring_cqe_seen(&oRing_, cqe);
+            oDone.iBusy_ = false;
+            ASSERT_OR_RAISE(res >= 0, std::runtime_error
+                , boost::format("Failed to write %s. %s") % name_ % ::strerror(-res));
+            if (static_cast<size_t>(res) < oDone.iLength_)
+            {
+                vWriteFully(fd_, oDone.oData_.get() + res, oDone.iLength_ - res, oDone.iOffset_ + res);
+            }
+        }
+        return;
+    }
+#endif
+    if (oBuffer.iBusy_)
+    {
+        oBuffer.iBusy_ = false;
+        oBuffer.oDone_.get();
+    }
+}
+
+void cDirectFileImpl::vClose()
+{
+    std::exception_ptr oError;
+    const size_t iTail = this->pptr() - this->pbase();
+    const auto iPadded = iAlignUp(iTail, iDirect_ ? iAlignment : 1);
+    try
+    {
+        if (iTail == iSynced_)
+        {
+            // The tail has been written by sync() already, if any.
+            iOffset_ += iPadded;
+        }
+        else
+        {
+            std::memset(this->pptr(), 0, iPadded - iTail);
+            this->vSubmit(iCurrent_, iPadded);
+        }
+    }
+    catch (...)
+    {
+        oError = std::current_exception();
+    }
+    this->setp(nullptr, nullptr);
+    // Every buffer must be released by the kernel before freeing it.
+    for (size_t i = 0; i < oBuffers_.size(); ++i)
+    {
+        try
+        {
+            this->vWait(i);
+        }
+        catch (...)
+        {
+            if ( ! oError)
+            {
+                oError = std::current_exception();
+            }
+        }
+    }
+#ifdef PS_HAVE_LIBURING
+    if (iUring_)
+    {
+        ::io_uring_queue_exit(&oRing_);
+    }
+#endif
+    iOffset_ -= iPadded - iTail;
+    if (iPadded != iTail && ! oError && ::ftruncate(fd_, iOffset_) != 0)
+    {
+        oError = std::make_exception_ptr(std::runtime_error(
+            (boost::format("Failed to truncate %s. %s") % name_ % ::strerror(errno)).str()));
+    }
+    if (::close(fd_) != 0 && ! oError)
+    {
+        oError = std::make_exception_ptr(std::runtime_error(
+            (boost::format("Failed to close %s. %s") % name_ % ::strerror(errno)).str()));
+    }
+    if (oError)
+    {
+        std::rethrow_exception(oError);
+    }
+}
+
+/**
+ * works to mediate between the interface and the implementation.
+ */
+cDirectFile::cDirectFile(
+    const std::string& sName
+    , const int64_t& iBufferBytes
+    , const int32_t& iQueueDepth
+)
+     : oImpl_(new cDirectFileImpl(sName, iBufferBytes, iQueueDepth)
+    , vRegularDeleter<cDirectFileImpl>)
+{
+    this->rdbuf(oImpl_.get());
+}
+
+} // ps::lib::nsStreamLocator
+
+} // ps::lib
+
+} // ps
@@ -28,15 +28,92 @@ namespace lib
 namespace nsStreamLocator
 {
 
+namespace
+{
+
+/**
+ * @class cPacedSink
+ * @brief
+ * A sink writing into a file descriptor, which paces the writeback by windows.
+ * The state is shared, because boost::iostreams copies the sink.
+ */
+class cPacedSink
+{
+public:
+    typedef char char_type;
+    typedef boost::iostreams::sink_tag category;
+    struct tState
+    {
+        int fd_;
+        int64_t iWritten_;
+        int64_t iPreallocated_;     ///< 0 if not preallocated.
+        int64_t iWindow_;           ///< 0 if the writeback is not paced.
+        int64_t iStarted_;          ///< Offset up to which the writeback has been started.
+        int32_t iNumWindows_;
+        std::chrono::steady_clock::duration oStall_;
+        std::chrono::steady_clock::duration oMaxStall_;
+    };
+    explicit cPacedSink(const std::shared_ptr<tState>& st)
+        : st_(st)
+    {}
+    std::streamsize write(const char* s, std::streamsize n)
+    {
+        auto& st = *st_;
+        for (auto iRest = n; iRest > 0; )
+        {
+            const auto rc = ::write(st.fd_, s + (n - iRest), iRest);
+            if (rc < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            ASSERT_OR_RAISE(rc > 0, std::runtime_error
+                , boost::format("Failed to write. %s") % ::strerror(rc < 0 ? errno : EIO));
+            iRest -= rc;
+        }
+        st.iWritten_ += n;
+        while (st.iWindow_ > 0 && st.iWritten_ - st.iStarted_ >= st.iWindow_)
+        {
+            vPace(st);
+        }
+        return n;
+    }
+private:
+    std::shared_ptr<tState> st_;
+    /**
+     * @brief
+     * Starts the writeback of the window filled, then waits for the previous one,
+     * which is no longer needed in the page cache.
+     */
+    static void vPace(tState& st)
+    {
+        ::sync_file_range(st.fd_, st.iStarted_, st.iWindow_, SYNC_FILE_RANGE_WRITE);
+        if (st.iStarted_ >= st.iWindow_)
+        {
+            const auto iPrev = st.iStarted_ - st.iWindow_;
+            const auto oBegin = std::chrono::steady_clock::now();
+            ::sync_file_range(st.fd_, iPrev, st.iWindow_
+                , SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER);
+            const auto oStall = std::chrono::steady_clock::now() - oBegin;
+            st.oStall_ += oStall;
+            st.oMaxStall_ = std::max(st.oMaxStall_, oStall);
+            ::posix_fadvise(st.fd_, iPrev, st.iWindow_, POSIX_FADV_DONTNEED);
+        }
+        st.iStarted_ += st.iWindow_;
+        ++st.iNumWindows_;
+    }
+};
+
+} // anonymous
+
 /**
  * @class cFileSystemImpl
  * @brief
  */
 class cFileSystemImpl
-    : public boost::iostreams::stream_buffer<boost::iostreams::file_sink>
+    : public boost::iostreams::stream_buffer<cPacedSink>
 {
 public:
-    explicit cFileSystemImpl(const std::string& sName);
+    cFileSystemImpl(const std::string& sName, const int64_t& iExpectedBytes);
     ~cFileSystemImpl();
 private:
     /// @brief A mutex for synchronizing states between each instance.
@@ -45,13 +122,15 @@ private:
     ps::lib::cTracer& trc_;
     /// @brief Output destination pipe name.
     boost::filesystem::path name_;
+    std::shared_ptr<cPacedSink::tState> st_;
 };
 
 std::mutex cFileSystemImpl::mtx_;
 
-cFileSystemImpl::cFileSystemImpl(const std::string& sName)
+cFileSystemImpl::cFileSystemImpl(const std::string& sName, const int64_t& iExpectedBytes)
     : trc_(ps::lib::cTracer::get_mutable_instance())
     , name_(sName)
+    , st_(std::make_shared<cPacedSink::tState>())
 {
     std::lock_guard<std::mutex> lock(mtx_);
     boost::filesystem::path sParentPath(name_.parent_path());
@@ -62,7 +141,23 @@ cFileSystemImpl::cFileSystemImpl(const std::string& sName)
         , std::runtime_error
         , boost::format("%s: specified %s") % ec.message() % sParentPath
     );
-    this->open(name_.string(), std::ios::out | std::ios::binary);
+    *st_ = cPacedSink::tState{-1, 0, 0, iWritebackWindow_, 0, 0, {}, {}};
+    st_->fd_ = ::open(name_.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+    ASSERT_OR_RAISE(st_->fd_ >= 0, std::runtime_error
+        , boost::format("Failed to open %s. %s") % name_ % ::strerror(errno));
+    if (iPreallocate_ && iExpectedBytes > 0)
+    {
+        // The size of the file is kept, so that it is never seen longer than written.
+        if (::fallocate(st_->fd_, FALLOC_FL_KEEP_SIZE, 0, iExpectedBytes) == 0)
+        {
+            st_->iPreallocated_ = iExpectedBytes;
+        }
+        else
+        {
+            trc_ << boost::format("cFileSystem could not preallocate %s. %s") % name_ % ::strerror(errno) << std::endl;
+        }
+    }
+    this->open(cPacedSink(st_));
     trc_ << boost::format("cFileSystem is opend: %s") % name_ << std::endl;
 }
 
@@ -72,19 +167,37 @@ cFileSystemImpl::~cFileSystemImpl()
     try
     {
         this->close();
-        trc_ << boost::format("cFileSystem is closed:%s") % name_ << std::endl;
+        // The blocks preallocated beyond the end are released.
+        if (st_->iPreallocated_ > st_->iWritten_)
+        {
+            ASSERT_OR_RAISE(::ftruncate(st_->fd_, st_->iWritten_) == 0, std::runtime_error
+                , boost::format("Failed to trim %s. %s") % name_ % ::strerror(errno));
+        }
+        ASSERT_OR_RAISE(::close(st_->fd_) == 0, std::runtime_error
+            , boost::format("Failed to close %s. %s") % name_ % ::strerror(errno));
+        st_->fd_ = -1;
+        typedef std::chrono::milliseconds ms;
+        trc_ << boost::format("cFileSystem is closed:%s (%s bytes, preallocated %s, %d windows, stall %dms, max %dms)")
+            % name_ % ps::lib::sIntToa(st_->iWritten_) % ps::lib::sIntToa(st_->iPreallocated_)
+            % st_->iNumWindows_
+            % std::chrono::duration_cast<ms>(st_->oStall_).count()
+            % std::chrono::duration_cast<ms>(st_->oMaxStall_).count() << std::endl;
     }
     catch (...)
     {
         // do nothing
     }
+    if (st_->fd_ >= 0)
+    {
+        ::close(st_->fd_);
+    }
 }
 
 /**
  * works to mediate between the interface and the implementation.
  */
-cFileSystem::cFileSystem(const std::string& sName)
-     : oImpl_(new cFileSystemImpl(sName)
+cFileSystem::cFileSystem(const std::string& sName, const int64_t& iExpectedBytes)
+     : oImpl_(new cFileSystemImpl(sName, iExpectedBytes)
     , vRegularDeleter<cFileSystemImpl>)
 {
     this->rdbuf(oImpl_.get());
@@ -155,7 +155,7 @@ public:
 };
 
 class cLocalProcessImpl
-    : public bio::stream_buffer<bio::file_descriptor_sink>
+    : public bio::stream_buffer<cPipeSink>
 {
 private:
     enum
@@ -264,7 +264,9 @@ cLocalProcessImpl::cLocalProcessImpl(
         }
         pid_ = pid;
         trc_ << boost::format("PID=%d Launched \"%s\"") % pid_ % sCommand_ << std::endl;
-        this->open(pipes[STDIN].detach(Pipe::Write), bio::close_handle);
+        // The buffer is as large as the pipe, so that one write fills it.
+        const cPipeSink oSink(pipes[STDIN].detach(Pipe::Write), sCommand_);
+        this->open(oSink, oSink.iGetCapacity());
         out_.open(pipes[STDOUT].detach(Pipe::Read), bio::close_handle);
         err_.open(pipes[STDERR].detach(Pipe::Read), bio::close_handle);
     }
@@ -36,7 +36,7 @@ namespace nsStreamLocator
  * of the cNamedPipe class.
  */
 class cNamedPipeImpl
-    : public boost::iostreams::stream_buffer<boost::iostreams::file_sink>
+    : public boost::iostreams::stream_buffer<cPipeSink>
 {
 public:
     explicit cNamedPipeImpl(const std::string& sName);
@@ -80,7 +80,9 @@ cNamedPipeImpl::cNamedPipeImpl(const std::string& sName)
     ++oItem.first;
     trc_ << boost::format("%s opening - referenced %d times in process")
         % name_ % oItem.first << std::endl;
-    this->open(name_, std::ios::out | std::ios::binary);
+    // Blocks until the reader opens the other end.
+    const cPipeSink oSink(::open(name_.c_str(), O_WRONLY | O_CLOEXEC), name_);
+    this->open(oSink, oSink.iGetCapacity());
     trc_ << boost::format("cNamedPipe is opend: \"%s\"") % name_ << std::endl;
 }
 
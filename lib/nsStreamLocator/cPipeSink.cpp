@@ -0,0 +1,130 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <pslib.h>
+
+namespace ps
+{
+namespace lib
+{
+namespace nsStreamLocator
+{
+
+/**
+ * @struct cPipeSink::tState
+ */
+struct cPipeSink::tState
+{
+    ps::lib::cTracer& trc_;
+    std::string name_;
+    int fd_;
+    std::streamsize iCapacity_;
+    int64_t iNumBytes_;
+    int64_t iNumWrites_;
+    int64_t iNumBlocked_;       ///< Times the pipe was full.
+    std::chrono::steady_clock::duration oBlocked_;
+    tState(const int& fd, const std::string& sName)
+        : trc_(ps::lib::cTracer::get_mutable_instance())
+        , name_(sName), fd_(fd), iCapacity_(0)
+        , iNumBytes_(0), iNumWrites_(0), iNumBlocked_(0), oBlocked_()
+    {}
+    ~tState()
+    {
+        if (fd_ >= 0)
+        {
+            ::close(fd_);
+        }
+    }
+};
+
+cPipeSink::cPipeSink(const int& fd, const std::string& sName)
+    : st_(std::make_shared<tState>(fd, sName))
+{
+    ASSERT_OR_RAISE(fd >= 0, std::runtime_error
+        , boost::format("Failed to open %s. %s") % sName % ::strerror(errno));
+    auto& st = *st_;
+    // Beyond /proc/sys/fs/pipe-max-size, only a privileged user can enlarge it.
+    if (iPipeBytes_ > 0 && ::fcntl(fd, F_SETPIPE_SZ, static_cast<int>(iPipeBytes_)) < 0)
+    {
+        st.trc_ << boost::format("%s: F_SETPIPE_SZ %d failed. %s")
+            % sName % iPipeBytes_ % ::strerror(errno) << std::endl;
+    }
+    const auto iCapacity = ::fcntl(fd, F_GETPIPE_SZ);
+    // A page is assumed if it is unknown.
+    st.iCapacity_ = iCapacity > 0 ? iCapacity : 4096;
+    ASSERT_OR_RAISE(::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK) == 0
+        , std::runtime_error, boost::format("%s: F_SETFL failed. %s") % sName % ::strerror(errno));
+}
+
+std::streamsize cPipeSink::write(const char* s, std::streamsize n)
+{
+    auto& st = *st_;
+    for (auto iRest = n; iRest > 0; )
+    {
+        const auto rc = ::write(st.fd_, s + (n - iRest), iRest);
+        if (rc > 0)
+        {
+            iRest -= rc;
+            ++st.iNumWrites_;
+            continue;
+        }
+        if (rc < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        ASSERT_OR_RAISE(rc < 0 && (errno == EAGAIN || errno == EWOULDBLOCK), std::runtime_error
+            , boost::format("Failed to write %s. %s") % st.name_ % ::strerror(rc < 0 ? errno : EIO));
+        // Waits for the reader to drain the pipe.
+        struct pollfd pfd = {st.fd_, POLLOUT, 0};
+        const auto oBegin = std::chrono::steady_clock::now();
+        while (::poll(&pfd, 1, -1) < 0 && errno == EINTR)
+        {}
+        st.oBlocked_ += std::chrono::steady_clock::now() - oBegin;
+        ++st.iNumBlocked_;
+    }
+    st.iNumBytes_ += n;
+    return n;
+}
+
+void cPipeSink::close()
+{
+    auto& st = *st_;
+    if (st.fd_ < 0)
+    {
+        return;
+    }
+    ::close(st.fd_);
+    st.fd_ = -1;
+    st.trc_ << boost::format("%s: %s bytes by %d writes through the pipe of %d bytes, blocked %d times for %dms")
+        % st.name_ % ps::lib::sIntToa(st.iNumBytes_) % st.iNumWrites_ % st.iCapacity_ % st.iNumBlocked_
+        % std::chrono::duration_cast<std::chrono::milliseconds>(st.oBlocked_).count() << std::endl;
+}
+
+std::streamsize cPipeSink::iGetCapacity() const
+{
+    return st_->iCapacity_;
+}
+
+} // ps::lib::nsStreamLocator
+
+} // ps::lib
+
+} // ps
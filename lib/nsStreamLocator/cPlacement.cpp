@@ -0,0 +1,210 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <pslib.h>
+
+namespace ps
+{
+namespace lib
+{
+namespace nsStreamLocator
+{
+
+namespace
+{
+
+/// @brief Weight of the latest sample of the moving averages.
+const double dWeight = 0.3;
+
+/// @return Bytes available to an unprivileged user, -1 if unknown.
+int64_t iGetFreeBytes(const boost::filesystem::path& sPath)
+{
+    struct statvfs st;
+    if (::statvfs(sPath.c_str(), &st) != 0)
+    {
+        return -1;
+    }
+    return static_cast<int64_t>(st.f_bavail) * st.f_frsize;
+}
+
+} // anonymous
+
+/**
+ * @details
+ */
+cPlacement::cPlacement()
+    : trc_(ps::lib::cTracer::get_mutable_instance())
+    , iMinimumFree_(0)
+    , dFileBytes_(0)
+{}
+/**
+ * @details
+ */
+void cPlacement::vSetDirectories(
+    const std::vector<boost::filesystem::path>& oDirectories
+    , const int64_t& iMinimumFree
+    , const int64_t& iFileBytes
+){
+    std::lock_guard<std::mutex> lk(mtx_);
+    oDirectories_.clear();
+    oLeases_.clear();
+    iMinimumFree_ = iMinimumFree;
+    dFileBytes_ = static_cast<double>(iFileBytes);
+    for (const auto& sPath: oDirectories)
+    {
+        ASSERT_OR_RAISE(boost::filesystem::is_directory(sPath), std::runtime_error
+            , boost::format("%s in dfile_alt_dirs is not a directory.") % sPath);
+        oDirectories_.push_back(tDirectory{sPath, 0, 0, 0});
+        trc_ << boost::format("Placement: %s has %s bytes free.")
+            % sPath % ps::lib::sIntToa(iGetFreeBytes(sPath)) << std::endl;
+    }
+}
+/**
+ * @details
+ *   A directory which has not been measured yet is assumed to be
+ *   as fast as the average of the measured ones.
+ */
+boost::filesystem::path cPlacement::sAcquire(int64_t& iExpectedBytes)
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    BOOST_ASSERT(! oDirectories_.empty());
+    if (iExpectedBytes <= 0)
+    {
+        iExpectedBytes = static_cast<int64_t>(dFileBytes_);
+    }
+    double dSumRate = 0;
+    int32_t iNumMeasured = 0;
+    for (const auto& oDir: oDirectories_)
+    {
+        if (oDir.dBytesPerSec_ > 0)
+        {
+            dSumRate += oDir.dBytesPerSec_;
+            ++iNumMeasured;
+        }
+    }
+    const auto dDefaultRate = iNumMeasured ? dSumRate / iNumMeasured : 1.0;
+    size_t iChosen = oDirectories_.size();
+    double dBestDrain = 0;
+    int64_t iBestFree = 0;
+    for (size_t i = 0; i < oDirectories_.size(); ++i)
+    {
+        const auto& oDir = oDirectories_[i];
+        const auto iFree = iGetFreeBytes(oDir.sPath_);
+        // The rest of the files open here, and the one to be opened.
+        const auto iExpected = oDir.iPending_ + iExpectedBytes;
+        if (iFree < 0 || iFree - iExpected < iMinimumFree_)
+        {
+            continue;
+        }
+        const auto dDrain = iExpected / (oDir.dBytesPerSec_ > 0 ? oDir.dBytesPerSec_ : dDefaultRate);
+        if (iChosen == oDirectories_.size()
+            || dDrain < dBestDrain
+            || (dDrain == dBestDrain && iFree > iBestFree))
+        {
+            iChosen = i;
+            dBestDrain = dDrain;
+            iBestFree = iFree;
+        }
+    }
+    ASSERT_OR_RAISE(iChosen < oDirectories_.size(), std::runtime_error
+        , boost::format("No directory in dfile_alt_dirs has %s bytes free.")
+            % ps::lib::sIntToa(iMinimumFree_));
+    auto& oDir = oDirectories_[iChosen];
+    ++oDir.iNumOpen_;
+    oDir.iPending_ += iExpectedBytes;
+    trc_ << boost::format("Placement: %s is chosen. free=%s, open=%d, pending=%s, rate=%.1fMB/s")
+        % oDir.sPath_ % ps::lib::sIntToa(iBestFree) % oDir.iNumOpen_
+        % ps::lib::sIntToa(oDir.iPending_) % (oDir.dBytesPerSec_ / (1 << 20)) << std::endl;
+    return oDir.sPath_;
+}
+/**
+ * @details
+ */
+void cPlacement::vAttach(
+    const boost::filesystem::path& sDirectory
+    , const boost::filesystem::path& sFile
+    , const int64_t& iExpectedBytes
+){
+    std::lock_guard<std::mutex> lk(mtx_);
+    for (size_t i = 0; i < oDirectories_.size(); ++i)
+    {
+        if (oDirectories_[i].sPath_ == sDirectory)
+        {
+            oLeases_[sFile] = tLease{i, iExpectedBytes, 0, 0};
+            return;
+        }
+    }
+}
+/**
+ * @details
+ *   The bytes beyond the expectation have not been counted as pending.
+ */
+void cPlacement::vAddWritten(const boost::filesystem::path& sFile, const int64_t& iBytes, const int64_t& iMicroSecs)
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    const auto it = oLeases_.find(sFile);
+    if (it == oLeases_.end())
+    {
+        return;
+    }
+    auto& oLease = it->second;
+    oDirectories_[oLease.iDirectory_].iPending_
+        -= std::max<int64_t>(0, std::min(iBytes, oLease.iExpected_ - oLease.iWritten_));
+    oLease.iWritten_ += iBytes;
+    oLease.iWriteMicroSecs_ += iMicroSecs;
+}
+/**
+ * @details
+ */
+void cPlacement::vRelease(const boost::filesystem::path& sFile)
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    const auto it = oLeases_.find(sFile);
+    if (it == oLeases_.end())
+    {
+        return;
+    }
+    const auto oLease = it->second;
+    oLeases_.erase(it);
+    auto& oDir = oDirectories_[oLease.iDirectory_];
+    --oDir.iNumOpen_;
+    oDir.iPending_ -= std::max<int64_t>(0, oLease.iExpected_ - oLease.iWritten_);
+    const auto iBytes = oLease.iWritten_;
+    if (iBytes == 0 || oLease.iWriteMicroSecs_ <= 0)
+    {
+        return;
+    }
+    const auto dRate = iBytes * 1000000.0 / oLease.iWriteMicroSecs_;
+    oDir.dBytesPerSec_ = oDir.dBytesPerSec_ > 0
+        ? oDir.dBytesPerSec_ * (1 - dWeight) + dRate * dWeight
+        : dRate;
+    dFileBytes_ = dFileBytes_ > 0
+        ? dFileBytes_ * (1 - dWeight) + iBytes * dWeight
+        : iBytes;
+    trc_ << boost::format("Placement: %s was written at %.1fMB/s, %s bytes.")
+        % sFile % (dRate / (1 << 20)) % ps::lib::sIntToa(iBytes) << std::endl;
+}
+
+} // ps::lib::nsStreamLocator
+
+} // ps::lib
+
+} // ps
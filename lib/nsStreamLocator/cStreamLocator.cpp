@@ -39,6 +39,9 @@ public:
     std::ostream* oOpen(const tExtType& iExtType, const std::string& sDataFileDir);
     const boost::filesystem::path& oGetsLastOpendFilename() const;
     const std::string sGetPartitionName() const;
+    void vSetPiece(const int32_t& iPiece);
+    void vSetExpectedBytes(const int64_t& iExpectedBytes);
+    void vSetDelta(const std::string& sDelta);
 private:
     /**
      * @class Token
@@ -124,7 +127,7 @@ cStreamLocatorImpl::cStreamLocatorImpl(
     , const std::string& sPartitionName
 )
     : trc_(ps::lib::cTracer::get_mutable_instance())
-    , rInitParams_({sOwner, sTableName, sPartitionName})
+    , rInitParams_({sOwner, sTableName, sPartitionName, 0, 0, ""})
 {}
 
 std::ostream* cStreamLocatorImpl::oOpen(const tExtType& iExtType, const std::string& sDataFileDir)
@@ -135,8 +138,10 @@ std::ostream* cStreamLocatorImpl::oOpen(const tExtType& iExtType, const std::str
     /*
      * Selection of scheme.
      */
+    // The sub-matches refer to the string, which must outlive them.
+    const auto sStreamLocator = sGetStreamLocator(iExtType);
     boost::smatch m;
-    boost::regex_match(sGetStreamLocator(iExtType), m, regLocationExpr);
+    boost::regex_match(sStreamLocator, m, regLocationExpr);
     const auto& scheme = m["scheme"].str();
     // A generator is choosen here. But std::ostream is not instantiated.
     const auto& itSelectedGenerator = oSchemeMap_.find(scheme);
@@ -157,6 +162,9 @@ std::ostream* cStreamLocatorImpl::oOpen(const tExtType& iExtType, const std::str
      * Holds the tokens obtained by analyzing the output location string.
      */
     boost::ptr_vector<Token> tokens_;
+    bool iHasPiece = false;
+    bool iHasDelta = false;
+    bool iHasAltDir = false;
     for (; it1 != it2; it1++)
     {
         const size_t pos = it1->position();
@@ -172,6 +180,9 @@ std::ostream* cStreamLocatorImpl::oOpen(const tExtType& iExtType, const std::str
             /* regMacroSymbolExpr matched fragment. */
             tokens_.push_back(
                 new VariableToken((*it1)["var"], (*it1)["opt"]));
+            iHasPiece = iHasPiece || (*it1)["var"] == "N";
+            iHasDelta = iHasDelta || (*it1)["var"] == "S";
+            iHasAltDir = iHasAltDir || (*it1)["var"] == "A";
         }
         catch (std::out_of_range&)
         {
@@ -186,14 +197,59 @@ std::ostream* cStreamLocatorImpl::oOpen(const tExtType& iExtType, const std::str
         tokens_.push_back(
             new LiteralToken(location.substr(lastPos)));
     }
+    // Only the data files are placed among dfile_alt_dirs, when {A} is not given by the caller.
+    auto& oPlacement(cPlacement::get_mutable_instance());
+    const auto iPlaced = iHasAltDir && sDataFileDir.empty()
+        && iExtType == iExtData && oPlacement.iEnabled();
+    auto iPlacedBytes = rInitParams_.iExpectedBytes;
+    const std::string sDir(iPlaced ? oPlacement.sAcquire(iPlacedBytes).string() : sDataFileDir);
     std::stringstream ss;
     for (auto& token : tokens_)
     {
-        ss << token(rInitParams_, iExtType, sDataFileDir);
+        ss << token(rInitParams_, iExtType, sDir);
     }
     // generates a kind of std::ostream.
     sLastOpendFilenme_ = ss.str();
-    return itSelectedGenerator->second(sLastOpendFilenme_.string());
+    // Only the data files are preallocated.
+    tInitParams oParams(rInitParams_);
+    if (iExtType != iExtData)
+    {
+        oParams.iExpectedBytes = 0;
+    }
+    // A delta must not overwrite the data file of the full unload.
+    // The control file is rewritten to load the delta, which _make.sh refers to.
+    if (rInitParams_.sDelta.size() && ! iHasDelta && iExtType == iExtData
+        && (scheme == "file" || scheme == "direct"))
+    {
+        const boost::filesystem::path sFull(sLastOpendFilenme_);
+        sLastOpendFilenme_ = sFull.parent_path() / (
+            sFull.stem().string() + rInitParams_.sDelta + sFull.extension().string()
+        );
+    }
+    if (rInitParams_.iPiece && ! iHasPiece && (scheme == "file" || scheme == "direct"))
+    {
+        const boost::filesystem::path sPiece(sLastOpendFilenme_);
+        sLastOpendFilenme_ = sPiece.parent_path() / (
+            sPiece.stem().string()
+            + (boost::format("_%03d") % rInitParams_.iPiece).str()
+            + sPiece.extension().string()
+        );
+    }
+    if ( ! iPlaced)
+    {
+        return itSelectedGenerator->second(sLastOpendFilenme_.string(), oParams);
+    }
+    // Released by the caller after the stream is closed.
+    oPlacement.vAttach(sDir, sLastOpendFilenme_, iPlacedBytes);
+    try
+    {
+        return itSelectedGenerator->second(sLastOpendFilenme_.string(), oParams);
+    }
+    catch (...)
+    {
+        oPlacement.vRelease(sLastOpendFilenme_);
+        throw;
+    }
 }
 
 const boost::filesystem::path& cStreamLocatorImpl::oGetsLastOpendFilename() const
@@ -207,6 +263,21 @@ const std::string cStreamLocatorImpl::sGetPartitionName() const
     return rInitParams_.sPartitionName;
 }
 
+void cStreamLocatorImpl::vSetPiece(const int32_t& iPiece)
+{
+    rInitParams_.iPiece = iPiece;
+}
+
+void cStreamLocatorImpl::vSetExpectedBytes(const int64_t& iExpectedBytes)
+{
+    rInitParams_.iExpectedBytes = iExpectedBytes;
+}
+
+void cStreamLocatorImpl::vSetDelta(const std::string& sDelta)
+{
+    rInitParams_.sDelta = sDelta;
+}
+
 /**
  * works to mediate between the interface and the implementation.
  */
@@ -239,6 +310,21 @@ const std::string cStreamLocator::sGetPartitionName() const
     return oImpl_->sGetPartitionName();
 }
 
+void cStreamLocator::vSetPiece(const int32_t& iPiece)
+{
+    oImpl_->vSetPiece(iPiece);
+}
+
+void cStreamLocator::vSetExpectedBytes(const int64_t& iExpectedBytes)
+{
+    oImpl_->vSetExpectedBytes(iExpectedBytes);
+}
+
+void cStreamLocator::vSetDelta(const std::string& sDelta)
+{
+    oImpl_->vSetDelta(sDelta);
+}
+
 } // ps::lib::nsStreamLocator
 
 } // ps::lib
@@ -37,6 +37,14 @@ std::string sConnectTo_;
 tExts oExts_;
 tEnvMap oEnvMap_;
 bool iSuppressCtrlf_;
+int32_t iCompressLevel_ = 0;
+int64_t iCompressFrameBytes_ = 4 << 20;
+int32_t iCompressThreads_ = 2;
+int64_t iDirectBufferBytes_ = 1 << 20;
+int32_t iDirectQueueDepth_ = 4;
+bool iPreallocate_ = false;
+int64_t iWritebackWindow_ = 0;
+int64_t iPipeBytes_ = 1 << 20;
 
 const boost::regex regLocationExpr(R"(\A(?<scheme>[[:alpha:]_][\w]*):(//)?(?<location>.*)\z)");
 const boost::regex regMacroSymbolExpr(R"(\{(?<var>[\u])(=(?<opt>.*?))?\})");
@@ -168,16 +176,51 @@ const ps::lib::cMap<std::string, tOstreamGenerator>
     oSchemeMap_ = {
     {
         "file"
-        , [](const std::string& sPathToFile) { return new cFileSystem(sPathToFile); }
+        , [](const std::string& sPathToFile, const tInitParams& rInitParams)
+        {
+            return new cFileSystem(sPathToFile, rInitParams.iExpectedBytes);
+        }
     }
     , {
         "ipc_pipe"
-        , [](const std::string& sToExecuteDmdLine) { return new cLocalProcess(sToExecuteDmdLine); }
+        , [](const std::string& sToExecuteDmdLine, const tInitParams&) { return new cLocalProcess(sToExecuteDmdLine); }
     }
     , {
         "named_pipe"
-        , [](const std::string& sPathToNamedPipe) { return new cNamedPipe(sPathToNamedPipe); }
+        , [](const std::string& sPathToNamedPipe, const tInitParams&) { return new cNamedPipe(sPathToNamedPipe); }
+    }
+    , {
+        "direct"
+        , [](const std::string& sPathToFile, const tInitParams&)
+        {
+            return new cDirectFile(sPathToFile, iDirectBufferBytes_, iDirectQueueDepth_);
+        }
+    }
+    , {
+        "gzip"
+        , [](const std::string& sPathToFile, const tInitParams&)
+        {
+            return new cCompressedFile(sPathToFile, cCompressedFile::iGzip, iCompressLevel_, iCompressFrameBytes_);
+        }
     }
+#ifdef PS_HAVE_ZSTD
+    , {
+        "zstd"
+        , [](const std::string& sPathToFile, const tInitParams&)
+        {
+            return new cCompressedFile(sPathToFile, cCompressedFile::iZstd, iCompressLevel_, iCompressFrameBytes_);
+        }
+    }
+#endif
+#ifdef PS_HAVE_LZ4
+    , {
+        "lz4"
+        , [](const std::string& sPathToFile, const tInitParams&)
+        {
+            return new cCompressedFile(sPathToFile, cCompressedFile::iLz4, iCompressLevel_, iCompressFrameBytes_);
+        }
+    }
+#endif
 };
 
 const ps::lib::cMap<std::string, tMacroAction>
@@ -213,6 +256,23 @@ const ps::lib::cMap<std::string, tMacroAction>
             ;
         }
     }
+    , {
+        "N"
+        , [](const tInitParams& rInitParams, const std::string&, const tExtType&, const std::string&)
+        {
+            return rInitParams.iPiece
+                ? (boost::format("_%03d") % rInitParams.iPiece).str()
+                : std::string("")
+            ;
+        }
+    }
+    , {
+        "S"
+        , [](const tInitParams& rInitParams, const std::string&, const tExtType& iExtType, const std::string&)
+        {
+            return iExtType == iExtData ? rInitParams.sDelta : std::string("");
+        }
+    }
     , {
         "A"
         , [](const tInitParams&, const std::string&, const tExtType&, const std::string& sDataFileDir)
@@ -416,6 +476,51 @@ std::string sGetStreamLocator(const tExtType& iExtType)
     return sRet;
 }
 
+void vSetCompression(
+    const int32_t iLevel
+    , const int64_t iFrameBytes
+    , const int32_t iNumThreads
+){
+    ASSERT_OR_RAISE(iLevel >= 0, std::runtime_error
+        , boost::format("Compression level must not be negative. Actually %d.") % iLevel);
+    ASSERT_OR_RAISE(iFrameBytes > 0, std::runtime_error
+        , boost::format("Frame size must be greater than zero. Actually %d.") % iFrameBytes);
+    ASSERT_OR_RAISE(iNumThreads > 0, std::runtime_error
+        , boost::format("Number of threads must be greater than zero. Actually %d.") % iNumThreads);
+    iCompressLevel_ = iLevel;
+    iCompressFrameBytes_ = iFrameBytes;
+    iCompressThreads_ = iNumThreads;
+}
+
+void vSetDirectIo(
+    const int64_t iBufferBytes
+    , const int32_t iQueueDepth
+){
+    ASSERT_OR_RAISE(iBufferBytes > 0, std::runtime_error
+        , boost::format("Buffer length must be greater than zero. Actually %d.") % iBufferBytes);
+    ASSERT_OR_RAISE(iQueueDepth > 0, std::runtime_error
+        , boost::format("Queue depth must be greater than zero. Actually %d.") % iQueueDepth);
+    iDirectBufferBytes_ = iBufferBytes;
+    iDirectQueueDepth_ = iQueueDepth;
+}
+
+void vSetWriteback(
+    const bool iPreallocate
+    , const int64_t iWindowBytes
+){
+    ASSERT_OR_RAISE(iWindowBytes >= 0, std::runtime_error
+        , boost::format("Writeback window must not be negative. Actually %d.") % iWindowBytes);
+    iPreallocate_ = iPreallocate;
+    iWritebackWindow_ = iWindowBytes;
+}
+
+void vSetPipe(const int64_t iPipeBytes)
+{
+    ASSERT_OR_RAISE(iPipeBytes >= 0 && iPipeBytes <= std::numeric_limits<int32_t>::max(), std::runtime_error
+        , boost::format("Pipe size is out of range. Actually %d.") % iPipeBytes);
+    iPipeBytes_ = iPipeBytes;
+}
+
 } // ps::lib::nsStreamLocator
 
 } // ps::lib
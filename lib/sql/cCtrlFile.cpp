@@ -71,6 +71,18 @@ public:
      *
      */
     std::string sGetGrammar() const;
+    /**
+     * @details
+     *   Adds one more INFILE clause, e.g. for the next piece of the data file.
+     */
+    void vAddInfile(const boost::filesystem::path& sFileName);
+    /**
+     * @details
+     *   Loads with APPEND instead of TRUNCATE, so that the pieces of
+     *   a data file can be loaded in parallel into the same table,
+     *   or a delta is loaded without the rows already loaded being removed.
+     */
+    void vSetAppend();
 private:
     const ps::lib::cConfigures& conf_;
     ps::lib::cDistributor& mos_;
@@ -85,6 +97,8 @@ private:
     const ps::lib::cDelimiter oDelim_;
     const int32_t iNumLongs_;
     boost::smatch oMatch_;
+    std::vector<boost::filesystem::path> oMoreFiles_;
+    bool iAppend_;
     cCtrlFileImpl(const cCtrlFileImpl&) =delete;
     cCtrlFileImpl& operator=(const cCtrlFileImpl&) =delete;
 };
@@ -107,6 +121,7 @@ cCtrlFileImpl::cCtrlFileImpl(
     , sPartitionName_(sPartitionName)
     , oDelim_(ps::lib::oMakeVarDelimiter())
     , iNumLongs_(iNumLongs)
+    , iAppend_(false)
 {
     BOOST_ASSERT(!sFileName.empty());
     BOOST_ASSERT(!sTagName.empty());
@@ -161,6 +176,14 @@ std::string cCtrlFileImpl::sGetGrammar(void) const
         % row_sep.str()
         << std::endl
         ;
+    for (const auto& sFileName: oMoreFiles_)
+    {
+        oss << boost::format(R"(INFILE %s "%s")")
+            % sFileName
+            % row_sep.str()
+            << std::endl
+            ;
+    }
     if (oMatch_["schema"].length() > 0)
     {
         oss << boost::format(R"(INTO TABLE "%s"."%s")")
@@ -172,7 +195,8 @@ std::string cCtrlFileImpl::sGetGrammar(void) const
             % oMatch_["table"];
     }
     oss << part_clause.str() << std::endl;
-    oss << boost::format("TRUNCATE REENABLE FIELDS TERMINATED BY %s")
+    oss << boost::format("%s REENABLE FIELDS TERMINATED BY %s")
+        % (iAppend_ ? "APPEND" : "TRUNCATE")
         % oDelim_.sGetColSeparator(ps::lib::cDelimiter::iCtrl)
         << std::endl
         ;
@@ -185,6 +209,17 @@ std::string cCtrlFileImpl::sGetGrammar(void) const
     return oss.str();
 }
 
+void cCtrlFileImpl::vAddInfile(const boost::filesystem::path& sFileName)
+{
+    BOOST_ASSERT(!sFileName.empty());
+    oMoreFiles_.push_back(sFileName);
+}
+
+void cCtrlFileImpl::vSetAppend()
+{
+    iAppend_ = true;
+}
+
 cCtrlFile::cCtrlFile(
     const boost::filesystem::path& sFileName
     , const std::string& sTagName
@@ -202,6 +237,16 @@ std::string cCtrlFile::sGetGrammar(void) const
     return oImpl_->sGetGrammar();
 }
 
+void cCtrlFile::vAddInfile(const boost::filesystem::path& sFileName)
+{
+    oImpl_->vAddInfile(sFileName);
+}
+
+void cCtrlFile::vSetAppend()
+{
+    oImpl_->vSetAppend();
+}
+
 } // ps::lib::sql
 
 } // ps::lib
@@ -33,49 +33,147 @@ namespace sql
 namespace occi
 {
 
+namespace
+{
+
+std::atomic<uint32_t> iNextSlot(0);
+/// Slot number of the calling thread, which selects the shard.
+thread_local const uint32_t iSlot = iNextSlot.fetch_add(1, std::memory_order_relaxed);
+
+} // anonymous
+
+cAllocator::tShard::tShard()
+    : pCur_(nullptr), pEnd_(nullptr)
+{
+    std::fill(std::begin(oFree_), std::end(oFree_), nullptr);
+}
+
 cAllocator::cAllocator()
     : trc_(ps::lib::cTracer::get_mutable_instance())
     , iMaloc(0), iRaloc(0), iMfree(0)
+    , iReused_(0), iLarge_(0), iChunks_(0)
 {}
 cAllocator::~cAllocator()
 {
-    trc_ << boost::format("@0x%p:maloc=%d, raloc=%d, mfree=%d")
-        % this % iMaloc % iRaloc % iMfree  << std::endl;
+    trc_ << boost::format("@0x%p:maloc=%d, raloc=%d, mfree=%d, reused=%d, large=%d, chunks=%d")
+        % this % iMaloc % iRaloc % iMfree % iReused_ % iLarge_ % iChunks_ << std::endl;
+    for (auto& oShard: oShards_)
+    {
+        for (auto p: oShard.oChunks_)
+        {
+            ::free(p);
+        }
+    }
 }
 
+uint32_t cAllocator::iClassOf(const size_t& size)
+{
+    const size_t iTotal = sizeof(tHeader) + size;
+    uint32_t iClass = 0;
+    while (iClass < NUM_CLASSES && iBlockSize(iClass) < iTotal)
+    {
+        ++iClass;
+    }
+    return iClass; // LARGE_CLASS if it exceeds the largest.
+}
+
+cAllocator::tShard& cAllocator::oShard()
+{
+    return oShards_[iSlot % NUM_SHARDS];
+}
 
 void* cAllocator::maloc(size_t size)
 {
-    std::lock_guard<std::mutex> lk(mtx_);
-    ++iMaloc;
-    auto len = size ? size : 1;
-    uint8_t* ptr = new uint8_t[len];
-    ::memset(ptr, 0, len);
-    m_.insert(ptr);
-    return ptr;
+    iMaloc.fetch_add(1, std::memory_order_relaxed);
+    const auto iClass = iClassOf(size);
+    tHeader* h = nullptr;
+    if (iClass == LARGE_CLASS)
+    {
+        iLarge_.fetch_add(1, std::memory_order_relaxed);
+        h = static_cast<tHeader*>(::malloc(sizeof(tHeader) + size));
+        if (! h)
+        {
+            return nullptr; // No exception may go through the OCI.
+        }
+    }
+    else
+    {
+        auto& oShard = this->oShard();
+        std::lock_guard<std::mutex> lk(oShard.mtx_);
+        if (oShard.oFree_[iClass])
+        {
+            iReused_.fetch_add(1, std::memory_order_relaxed);
+            h = oShard.oFree_[iClass];
+            // The link to the next block is stored in the body.
+            oShard.oFree_[iClass] = *reinterpret_cast<tHeader**>(h + 1);
+        }
+        else
+        {
+            const auto iBlock = iBlockSize(iClass);
+            if (oShard.pEnd_ - oShard.pCur_ < static_cast<ptrdiff_t>(iBlock))
+            {
+                // The rest of the current chunk is abandoned.
+                char* p = static_cast<char*>(::malloc(CHUNK_SIZE));
+                if (! p)
+                {
+                    return nullptr;
+                }
+                oShard.oChunks_.push_back(p);
+                oShard.pCur_ = p;
+                oShard.pEnd_ = p + CHUNK_SIZE;
+                iChunks_.fetch_add(1, std::memory_order_relaxed);
+            }
+            h = reinterpret_cast<tHeader*>(oShard.pCur_);
+            oShard.pCur_ += iBlock;
+        }
+    }
+    h->iClass_ = iClass;
+    h->iSize_ = size;
+    return h + 1;
 }
 
 void* cAllocator::raloc(void* memptr, size_t newsize)
 {
-    std::lock_guard<std::mutex> lk(mtx_);
-    ++iRaloc;
-    auto it = m_.find(static_cast<uint8_t*>(memptr));
-    delete [] *it;
-    m_.erase(it);
-    auto len = newsize ? newsize : 1;
-    uint8_t* ptr = new uint8_t[len];
-    ::memset(ptr, 0, len);
-    m_.insert(ptr);
+    iRaloc.fetch_add(1, std::memory_order_relaxed);
+    if (! memptr)
+    {
+        return maloc(newsize);
+    }
+    tHeader* h = static_cast<tHeader*>(memptr) - 1;
+    if (h->iClass_ != LARGE_CLASS && h->iClass_ == iClassOf(newsize))
+    {
+        // The block is large enough as it is.
+        h->iSize_ = newsize;
+        return memptr;
+    }
+    void* ptr = maloc(newsize);
+    if (! ptr)
+    {
+        return nullptr; // The old block is left as realloc does.
+    }
+    ::memcpy(ptr, memptr, std::min(h->iSize_, newsize));
+    mfree(memptr);
     return ptr;
 }
 
 void cAllocator::mfree(void* memptr)
 {
-    std::lock_guard<std::mutex> lk(mtx_);
-    ++iMfree;
-    auto it = m_.find(static_cast<uint8_t*>(memptr));
-    delete [] *it;
-    m_.erase(it);
+    if (! memptr)
+    {
+        return;
+    }
+    iMfree.fetch_add(1, std::memory_order_relaxed);
+    tHeader* h = static_cast<tHeader*>(memptr) - 1;
+    if (h->iClass_ == LARGE_CLASS)
+    {
+        ::free(h);
+        return;
+    }
+    // Returned to the shard of the freeing thread.
+    auto& oShard = this->oShard();
+    std::lock_guard<std::mutex> lk(oShard.mtx_);
+    *reinterpret_cast<tHeader**>(h + 1) = oShard.oFree_[h->iClass_];
+    oShard.oFree_[h->iClass_] = h;
 }
 
 void *maloc(void* ctxp, size_t size)
@@ -94,13 +94,27 @@ cAttr * cAttr::oMakeInstance(
     case oracle::occi::OCCI_SQLT_DAT:
         oAttr = new nsReprVar::cDate(oOciStmt, pos, dType, sName, meta, iBulkSize);
         break;
-    case oracle::occi::OCCI_SQLT_LNG:  // LONG
     case oracle::occi::OCCI_SQLT_CLOB: // CLOB, NCLOB
+        if (conf_.as<bool>("lob_streaming"))
+        {
+            oAttr = new nsReprVar::cLobStream<nsLob::tChr, oracle::occi::OCCI_SQLT_CLOB>
+                (oOciStmt, pos, dType, sName, meta, iBulkSize);
+            break;
+        }
+        // fall through
+    case oracle::occi::OCCI_SQLT_LNG:  // LONG
         oAttr = new nsReprVar::cLob<nsLob::tChr, oracle::occi::OCCI_SQLT_LNG>
             (oOciStmt, pos, dType, sName, meta, iBulkSize);
         break;
-    case oracle::occi::OCCI_SQLT_LBI:  // LONG RAW
     case oracle::occi::OCCI_SQLT_BLOB: // BLOB
+        if (conf_.as<bool>("lob_streaming"))
+        {
+            oAttr = new nsReprVar::cLobStream<nsLob::tRaw, oracle::occi::OCCI_SQLT_BLOB>
+                (oOciStmt, pos, dType, sName, meta, iBulkSize);
+            break;
+        }
+        // fall through
+    case oracle::occi::OCCI_SQLT_LBI:  // LONG RAW
         oAttr = new nsReprVar::cLob<nsLob::tRaw, oracle::occi::OCCI_SQLT_LBI>
             (oOciStmt, pos, dType, sName, meta, iBulkSize);
         break;
@@ -35,6 +35,43 @@ namespace sql
 namespace occi
 {
 
+/**
+ * @class cConvertedText
+ * @brief
+ * - Holds the texts converted on the client from one bulk of binary values.
+ * - It is filled by cAttr::vBeginBulk, and exposed by cAttr::iGetView.
+ */
+class cConvertedText
+{
+private:
+    ub4 iStride_;  ///< Distance in bytes between two texts.
+    std::unique_ptr<char[]> szText_;
+    std::unique_ptr<ub2[]> iLength_;
+public:
+    cConvertedText()
+        : iStride_(0)
+    {}
+    void vAlloc(const ub4& iStride, const uint32_t& iBulkSize)
+    {
+        iStride_ = iStride;
+        szText_.reset(new char[iStride_ * iBulkSize]);
+        iLength_.reset(new ub2[iBulkSize]);
+    }
+    bool iIsAllocated() const { return szText_ != nullptr; }
+    char* szAt(const ub4& iRow) const { return szText_.get() + iStride_ * iRow; }
+    ub2& iLengthAt(const ub4& iRow) const { return iLength_[iRow]; }
+    void vGetView(const sb2* ind, const bool& iEnclose, cAttr::tView& oView) const
+    {
+        oView.data_ = szText_.get();
+        oView.size_ = iStride_;
+        oView.ind_ = ind;
+        oView.length_ = iLength_.get();
+        oView.iEnclose_ = iEnclose;
+        oView.fpFormat_ = nullptr;
+        oView.iMaxLength_ = 0;
+    }
+};
+
 class cAttrImpl
 {
 protected:
@@ -54,12 +91,17 @@ protected:
     int32_t dPrecision_;
     int32_t dScale_;
     const uint32_t& iBulkSize_;
-    void *data_;
+    void *data_;  // points to the buffer set which is currently converted.
     oracle::occi::Type type_;
     ub4 size_;  // indicates length of data in bytes.
     sb2 *ind_;
     ub2 *length_;
     ub2 *rc_;
+    uint32_t iNumSets_;  // number of the buffer sets rotated by cStmt::iFetch.
+    char *dataSets_;     // owns the all buffer sets, data_ points into here.
+    sb2 *indSets_;
+    ub2 *lengthSets_;
+    ub2 *rcSets_;
     cAttrImpl(
         ps::lib::sql::occi::cOciStmt& oOciStmt
         , const uint32_t& pos
@@ -84,30 +126,80 @@ protected:
         , ind_(0)
         , length_(0)
         , rc_(0)
+        , iNumSets_(1)
+        , dataSets_(0)
+        , indSets_(0)
+        , lengthSets_(0)
+        , rcSets_(0)
     {}
     ~cAttrImpl()
     {
-        if (data_) delete [] (char *) data_;
-        if (ind_) delete [] ind_;
-        if (length_) delete [] length_;
-        if (rc_) delete [] rc_;
+        if (dataSets_) delete [] dataSets_;
+        if (indSets_) delete [] indSets_;
+        if (lengthSets_) delete [] lengthSets_;
+        if (rcSets_) delete [] rcSets_;
     }
     void vAllocCommon()
     {
-        ind_ = new sb2[iBulkSize_];
-        length_ = new ub2[iBulkSize_];
-        rc_ = new ub2[iBulkSize_];
+        const auto iNumElems = iBulkSize_ * iNumSets_;
+        ind_ = indSets_ = new sb2[iNumElems];
+        length_ = lengthSets_ = new ub2[iNumElems];
+        rc_ = rcSets_ = new ub2[iNumElems];
         /*
          * Cleaning up length_[] is nessasory to prebent unconformity
          * datagram outputting when parallel degree is especialy (>=8) high.
          */
-        ::memset(length_, 0, sizeof(ub2) * iBulkSize_);
+        ::memset(lengthSets_, 0, sizeof(ub2) * iNumElems);
     }
     void vAllocMemory() 
     {
-        data_ = new char[size_ * iBulkSize_];
+        data_ = dataSets_ = new char[size_ * iBulkSize_ * iNumSets_];
         vAllocCommon(); 
     }
+    /**
+     * @brief
+     * - Must be called before vAllocMemory.
+     * @param [in] iNumSets
+     *   Number of buffer sets to be allocated. 
+     */
+    void vSetNumBufferSets(const uint32_t& iNumSets)
+    {
+        BOOST_ASSERT(iNumSets);
+        BOOST_ASSERT(dataSets_ == 0);
+        iNumSets_ = iNumSets;
+    }
+    /**
+     * @brief
+     * - Notifies oDefine of the address of the iSet th buffer set.
+     * - This is called on the fetching thread, so members referred
+     *   by the converting thread (data_, ind_, ...) must not be touched.
+     */
+    void vChangeDataBuffer(
+        ps::lib::sql::occi::cDefine& oDefine
+        , const uint32_t& iSet
+    ) const
+    {
+        BOOST_ASSERT(iSet < iNumSets_);
+        const auto iOffset = iBulkSize_ * iSet;
+        oDefine.vChangeAddr(
+            pos_, dataSets_ + size_ * iOffset, size_
+            , (ps::lib::sql::ind_t *) (indSets_ + iOffset)
+            , lengthSets_ + iOffset, rcSets_ + iOffset
+        );
+    }
+    /**
+     * @brief
+     * - Switches the buffer set referred by vAppendTo.
+     */
+    void vSelectBufferSet(const uint32_t& iSet)
+    {
+        BOOST_ASSERT(iSet < iNumSets_);
+        const auto iOffset = iBulkSize_ * iSet;
+        data_ = dataSets_ + size_ * iOffset;
+        ind_ = indSets_ + iOffset;
+        length_ = lengthSets_ + iOffset;
+        rc_ = rcSets_ + iOffset;
+    }
     void vSetDataBuffer(ps::lib::sql::occi::cDefine& oDefine) 
     {
         BOOST_ASSERT(data_);
@@ -133,23 +225,33 @@ protected:
     {
         return iBulkSize_ * ( size_ + sizeof(sb2) + sizeof(ub2) + sizeof(ub2) ); 
     }
-    void vConvertStringVct(
-        ps::lib::str_vct& oRowBuf
-        , const ub4& iNumIter
+    void vAppendTo(
+        ps::lib::cSlab& oSlab
+        , const ub4& iRow
         , const bool& iSep
         , const ps::lib::cDelimiter& oDelim
     ) const
     {
-        std::string sBuf;
-        for (ub4 iRow = 0; iRow < iNumIter; ++iRow)
-        {
-            oDelim.vEnCls(
-                oRowBuf[iRow]
-                , sBuf.assign(static_cast<char *>(data_) + (size_ * iRow), length_[iRow])
-                , static_cast<ps::lib::sql::ind_t>(ind_[iRow])
-                , iSep
-            );
-        }
+        oDelim.vEnCls(
+            oSlab
+            , static_cast<char *>(data_) + (size_ * iRow), length_[iRow]
+            , static_cast<ps::lib::sql::ind_t>(ind_[iRow])
+            , iSep
+        );
+    }
+    bool iGetView(cAttr::tView& oView) const
+    {
+        oView.data_ = static_cast<const char *>(data_);
+        oView.size_ = size_;
+        oView.ind_ = ind_;
+        oView.length_ = length_;
+        oView.iEnclose_ = true;
+        oView.fpFormat_ = nullptr;
+        oView.iMaxLength_ = 0;
+        return true;
+    }
+    void vEndBulk() const
+    {
         ::memset(length_, 0, sizeof(ub2) * iBulkSize_);
     }
     std::string sGetFieldType() const
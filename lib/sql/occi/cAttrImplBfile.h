@@ -49,8 +49,7 @@ private:
     mutable ps::lib::sql::occi::cOciErr oOciErr_;
     void vAllocMemory() 
     {
-        data_ = new char[size_ * iBulkSize_];
-        vAllocCommon(); 
+        cAttrImpl::vAllocMemory();
         for (uint32_t i = 0; i < iBulkSize_; ++i)
         {
             ps::lib::sql::occi::vDescriptorAlloc(
@@ -108,42 +107,28 @@ public:
         ;
     }
     virtual int32_t iGetBufMemSize() const { return cAttrImpl::iGetBufMemSize(); }
-    virtual void vConvertStringVct(
-        ps::lib::str_vct& oRowBuf
-        , const ub4& iNumIter
+    virtual void vAppendTo(
+        ps::lib::cSlab& oSlab
+        , const ub4& iRow
         , const bool& iSep
         , const ps::lib::cDelimiter& oDelim
     ) const
     {
-        std::string sBuf;
-        for (ub4 iRow = 0; iRow < iNumIter; ++iRow)
+        boolean bFlag = true;  // true: OS file exists.
+        ub2 nALength = ALIAS_NAME_LENGTH;
+        ub2 nFLength = FILE_NAME_LENGTH;
+        ps::lib::sql::ind_t ind = static_cast<ps::lib::sql::ind_t>(ind_[iRow]);
+        if (ind == ps::lib::sql::ind_t::VAL_IS_NOTNULL)
         {
-            boolean bFlag = true;  // true: OS file exists.
-            ub2 nALength = ALIAS_NAME_LENGTH;
-            ub2 nFLength = FILE_NAME_LENGTH;
-            ps::lib::sql::ind_t ind = static_cast<ps::lib::sql::ind_t>(ind_[iRow]);
-            if (ind == ps::lib::sql::ind_t::VAL_IS_NOTNULL)
-            {
-                ps::lib::sql::occi::vLobFileGetName(
-                    oOciStmt_, ((OCILobLocator **)data_)[iRow]
-                    , szAlias_, &nALength, szFName_, &nFLength, &bFlag
-                );
-            }
-            // An alias name outputting.
-            oDelim.vEnCls(
-                oRowBuf[iRow]
-                , sBuf.assign(szAlias_, nALength)
-                , ind
-                , true
-            );
-            // A file name outputting.
-            oDelim.vEnCls(
-                oRowBuf[iRow]
-                , sBuf.assign(szFName_, nFLength)
-                , ind
-                , iSep
+            ps::lib::sql::occi::vLobFileGetName(
+                oOciStmt_, ((OCILobLocator **)data_)[iRow]
+                , szAlias_, &nALength, szFName_, &nFLength, &bFlag
             );
         }
+        // An alias name outputting.
+        oDelim.vEnCls(oSlab, szAlias_, nALength, ind, true);
+        // A file name outputting.
+        oDelim.vEnCls(oSlab, szFName_, nFLength, ind, iSep);
     }
     virtual std::string sGetFieldType() const { return cAttrImpl::sGetFieldType(); }
 };
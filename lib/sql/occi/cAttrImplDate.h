@@ -41,7 +41,11 @@ class cDate
     , private cAttrImpl
 {
 private:
+    enum { DATE_SIZE = 7 }; ///< Length of SQLT_DAT in bytes.
     std::string sMask_;
+    cDateFormatter oFormatter_;
+    bool iNative_;          ///< true if the values are fetched as SQLT_DAT and formatted here.
+    cConvertedText oText_;  ///< Texts formatted from one bulk.
 public:
     cDate(
         ps::lib::sql::occi::cOciStmt& oOciStmt
@@ -53,11 +57,28 @@ public:
     )
         : cAttrImpl(oOciStmt, pos, dType, sName, meta, iBulkSize)
         , sMask_(conf_.as<std::string>("date_mask"))
+        , oFormatter_(sMask_, 0)
+        , iNative_(false)
     {
         size_ = sMask_.size();
         iWidth_ = size_;
         sType_ = "DATE";
         type_ = oracle::occi::OCCI_SQLT_CHR;
+        if (conf_.as<bool>("native_datetime"))
+        {
+            if (oFormatter_.iIsSupported())
+            {
+                iNative_ = true;
+                size_ = DATE_SIZE;
+                type_ = oracle::occi::OCCI_SQLT_DAT;
+                oText_.vAlloc(oFormatter_.iGetMaxLength(), iBulkSize);
+            }
+            else
+            {
+                trc_ << boost::format("%s; Mask \"%s\" is not supported by the client-side formatter.")
+                    % sName_ % sMask_ << std::endl;
+            }
+        }
     }
     virtual ~cDate()
     {
@@ -80,13 +101,65 @@ public:
         ;
     }
     virtual int32_t iGetBufMemSize() const { return cAttrImpl::iGetBufMemSize(); }
-    virtual void vConvertStringVct(
-        ps::lib::str_vct& oRowBuf
-        , const ub4& iNumIter
+    /**
+     * @brief
+     *   Formats all values of the bulk into oText_ at once, if they were fetched as SQLT_DAT.
+     */
+    virtual void vBeginBulk(const ub4& iNumIter) const
+    {
+        if (! iNative_)
+        {
+            return;
+        }
+        cDateFormatter::tDateTime t;
+        for (auto iRow = 0u; iRow < iNumIter; ++iRow)
+        {
+            if (static_cast<ps::lib::sql::ind_t>(ind_[iRow]) != ps::lib::sql::ind_t::VAL_IS_NOTNULL)
+            {
+                oText_.iLengthAt(iRow) = 0;
+                continue;
+            }
+            cDateFormatter::vFromOciDate(static_cast<const ub1*>(data_) + size_ * iRow, t);
+            oText_.iLengthAt(iRow) = oFormatter_.iFormat(t, oText_.szAt(iRow));
+        }
+    }
+    virtual void vAppendTo(
+        ps::lib::cSlab& oSlab
+        , const ub4& iRow
         , const bool& iSep
         , const ps::lib::cDelimiter& oDelim
-    ) const { cAttrImpl::vConvertStringVct(oRowBuf, iNumIter, iSep, oDelim); }
+    ) const
+    {
+        if (iNative_)
+        {
+            oDelim.vEnCls(
+                oSlab, oText_.szAt(iRow), oText_.iLengthAt(iRow)
+                , static_cast<ps::lib::sql::ind_t>(ind_[iRow]), iSep
+            );
+        }
+        else
+        {
+            cAttrImpl::vAppendTo(oSlab, iRow, iSep, oDelim);
+        }
+    }
+    virtual void vEndBulk(const ub4& iNumIter) const { cAttrImpl::vEndBulk(); }
+    virtual bool iGetView(tView& oView) const
+    {
+        if (iNative_)
+        {
+            oText_.vGetView(ind_, true, oView);
+            return true;
+        }
+        return cAttrImpl::iGetView(oView);
+    }
     virtual std::string sGetFieldType() const { return cAttrImpl::sGetFieldType(); }
+    virtual bool iCanRotateBuffers() const { return true; }
+    virtual void vSetNumBufferSets(const uint32_t& iNumSets) { cAttrImpl::vSetNumBufferSets(iNumSets); }
+    virtual void vChangeDataBuffer(
+        ps::lib::sql::occi::cDefine& oDefine
+        , const uint32_t& iSet
+    ) const { cAttrImpl::vChangeDataBuffer(oDefine, iSet); }
+    virtual void vSelectBufferSet(const uint32_t& iSet) { cAttrImpl::vSelectBufferSet(iSet); }
 };
 
 } // ps::lib::sql::occi::nsReprVar
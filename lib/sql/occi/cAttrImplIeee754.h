@@ -47,8 +47,16 @@ class cIeee754
     , private cAttrImpl
 {
 private:
-    std::string sMask_;
-    char *szBuffer_;
+    /**
+     * @brief
+     *   Formats a value to the shortest string which is read back to the same value.
+     */
+    static size_t iFormatValue(const char* szValue, char* szDest)
+    {
+        hostT v;
+        ::memcpy(&v, szValue, sizeof(v));
+        return ps::lib::cFloatFormatter::iFormat(v, szDest, iPrecision);
+    }
 public:
     cIeee754(
         ps::lib::sql::occi::cOciStmt& oOciStmt
@@ -59,17 +67,14 @@ public:
         , const uint32_t& iBulkSize
     )
         : cAttrImpl(oOciStmt, pos, dType, sName, meta, iBulkSize)
-        , sMask_("%0.*G"), szBuffer_(0)
     {
         size_ = sizeof(hostT);
         iWidth_ = iPrtSize;
         sType_ = "DECIMAL EXTERNAL";
         type_ = occiT;
-        szBuffer_ = new char[iPrtSize + 1];
     }
     virtual ~cIeee754()
     {
-        if (szBuffer_) delete [] szBuffer_;
 #ifndef NDEBUG
         trc_ << boost::format("%s; %s") % __PRETTY_FUNCTION__ % sName_ << std::endl;
 #endif
@@ -87,39 +92,40 @@ public:
         ;
     }
     virtual int32_t iGetBufMemSize() const { return cAttrImpl::iGetBufMemSize(); }
-    virtual void vConvertStringVct(
-        ps::lib::str_vct& oRowBuf
-        , const ub4& iNumIter
+    virtual void vAppendTo(
+        ps::lib::cSlab& oSlab
+        , const ub4& iRow
         , const bool& iSep
         , const ps::lib::cDelimiter& oDelim
     ) const
     {
-        std::string sBuf;
-        for (ub4 iRow = 0; iRow < iNumIter; ++iRow)
+        ps::lib::sql::ind_t ind = static_cast<ps::lib::sql::ind_t>(ind_[iRow]);
+        if (ind == ps::lib::sql::ind_t::VAL_IS_NOTNULL)
         {
-            ub4 iBuffer;
-            ps::lib::sql::ind_t ind = static_cast<ps::lib::sql::ind_t>(ind_[iRow]);
-            if (ind == ps::lib::sql::ind_t::VAL_IS_NOTNULL)
-            {
-                iBuffer = ::snprintf(
-                    szBuffer_, iPrtSize + 1, sMask_.c_str()
-                    , iPrecision, static_cast<hostT*>(data_)[iRow]
-                );
-            }
-            else
-            {
-                szBuffer_[0] = '\0';
-                iBuffer = 0;
-            }
-            oDelim.vUnCls(
-                oRowBuf[iRow]
-                , sBuf.assign(szBuffer_, iBuffer)
-                , ind
-                , iSep
+            const auto iHead = oSlab.size();
+            const auto iLen = iFormatValue(
+                static_cast<const char*>(data_) + size_ * iRow, oSlab.szReserve(iPrtSize)
             );
+            oSlab.vTruncate(iHead + iLen);
         }
+        if (iSep) oSlab += oDelim.sGetColSeparator(ps::lib::cDelimiter::iData);
+    }
+    virtual bool iGetView(tView& oView) const
+    {
+        cAttrImpl::iGetView(oView);
+        oView.iEnclose_ = false; // Numbers are not enclosed.
+        oView.fpFormat_ = &iFormatValue;
+        oView.iMaxLength_ = iPrtSize;
+        return true;
     }
     virtual std::string sGetFieldType() const { return cAttrImpl::sGetFieldType(); }
+    virtual bool iCanRotateBuffers() const { return true; }
+    virtual void vSetNumBufferSets(const uint32_t& iNumSets) { cAttrImpl::vSetNumBufferSets(iNumSets); }
+    virtual void vChangeDataBuffer(
+        ps::lib::sql::occi::cDefine& oDefine
+        , const uint32_t& iSet
+    ) const { cAttrImpl::vChangeDataBuffer(oDefine, iSet); }
+    virtual void vSelectBufferSet(const uint32_t& iSet) { cAttrImpl::vSelectBufferSet(iSet); }
 };
 
 } // ps::lib::sql::occi::nsReprVar
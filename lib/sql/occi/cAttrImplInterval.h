@@ -80,13 +80,22 @@ public:
         ;
     }
     virtual int32_t iGetBufMemSize() const { return cAttrImpl::iGetBufMemSize(); }
-    virtual void vConvertStringVct(
-        ps::lib::str_vct& oRowBuf
-        , const ub4& iNumIter
+    virtual void vAppendTo(
+        ps::lib::cSlab& oSlab
+        , const ub4& iRow
         , const bool& iSep
         , const ps::lib::cDelimiter& oDelim
-    ) const { cAttrImpl::vConvertStringVct(oRowBuf, iNumIter, iSep, oDelim); }
+    ) const { cAttrImpl::vAppendTo(oSlab, iRow, iSep, oDelim); }
+    virtual void vEndBulk(const ub4& iNumIter) const { cAttrImpl::vEndBulk(); }
+    virtual bool iGetView(tView& oView) const { return cAttrImpl::iGetView(oView); }
     virtual std::string sGetFieldType() const { return cAttrImpl::sGetFieldType(); }
+    virtual bool iCanRotateBuffers() const { return true; }
+    virtual void vSetNumBufferSets(const uint32_t& iNumSets) { cAttrImpl::vSetNumBufferSets(iNumSets); }
+    virtual void vChangeDataBuffer(
+        ps::lib::sql::occi::cDefine& oDefine
+        , const uint32_t& iSet
+    ) const { cAttrImpl::vChangeDataBuffer(oDefine, iSet); }
+    virtual void vSelectBufferSet(const uint32_t& iSet) { cAttrImpl::vSelectBufferSet(iSet); }
 };
 
 } // ps::lib::sql::occi::nsReprVar
@@ -44,15 +44,15 @@ protected:
         return "VARCHARC(" + boost::lexical_cast<std::string>(NUM_DIGITS_VARCHARC)
                     + ", " + boost::lexical_cast<std::string>(iLength) + ")";
     }
-    std::string sRowHeader(
-        std::ostringstream& oss
+    void vPutRowHeader(
+        ps::lib::cSlab& oSlab
         , const int32_t& iDigit
         , const std::string::size_type& size
     ) const
     {
-        oss.fill('0');
-        oss << std::setw(iDigit) << size;
-        return oss.str();
+        const auto iOffset = oSlab.size();
+        oSlab.szReserve(iDigit);
+        oSlab.vPatchDecimal(iOffset, iDigit, size);
     }
 };
 
@@ -63,19 +63,17 @@ protected:
     {
         return "LONG VARRAW(" + boost::lexical_cast<std::string>(iLength) + ")";
     }
-    std::string sRowHeader(
-        std::ostringstream& oss
+    void vPutRowHeader(
+        ps::lib::cSlab& oSlab
         , const int32_t& iDigit
         , const std::string::size_type& size
     ) const
     {
-        char raw[4];
+        char* raw = oSlab.szReserve(4);
         raw[0] = static_cast<char>( size        & ~0x100);
         raw[1] = static_cast<char>((size >>  8) & ~0x100);
         raw[2] = static_cast<char>((size >> 16) & ~0x100);
         raw[3] = static_cast<char>((size >> 24) & ~0x100);
-        oss << std::string(raw, 4);
-        return oss.str();
     }
 };
 
@@ -164,29 +162,246 @@ public:
     {
         return iBulkSize_ * (iPieceSize_ + iSkip_); 
     }
-    virtual void vConvertStringVct(
-        ps::lib::str_vct& oRowBuf
-        , const ub4& iNumIter
+    virtual void vBeginBulk(const ub4& iNumIter) const
+    {
+        ps::lib::sql::occi::cPieceVct::vTerminateLatest(&pv_, iNumIter);
+    }
+    virtual void vAppendTo(
+        ps::lib::cSlab& oSlab
+        , const ub4& iRow
         , const bool& iSep
         , const ps::lib::cDelimiter& oDelim
     ) const
     {
-        ps::lib::sql::occi::cPieceVct::vTerminateLatest(&pv_, iNumIter);
-        std::ostringstream oss;
-        int32_t iDigit = oDelim.iGetVarDigit();
-        for (ub4 iRow = 0; iRow < iNumIter; ++iRow)
+        T::vPutRowHeader(oSlab, oDelim.iGetVarDigit(), rTable_[iRow].iTextLen);
+        oDelim.vUnCls(
+            oSlab
+            , rTable_[iRow].szText
+            , rTable_[iRow].iTextLen
+            , rTable_[iRow].iTextInd
+            , false
+        );
+    }
+    virtual std::string sGetFieldType() const { return cAttrImpl::sGetFieldType(); }
+};
+
+/**
+ * @class cLobStream
+ * @brief
+ * - CLOB or BLOB fetched as a locator, instead of a whole value.
+ * - In vAppendTo, the value is read piece by piece into the slab,
+ *   which is spilled to the writer when it has grown to a piece.
+ *   Therefore the memory per thread is bounded to a few pieces.
+ * - The length header is written first. For a BLOB, or a CLOB in a
+ *   single-byte character set, the length is taken from the locator.
+ *   Otherwise the value is read once to count the bytes,
+ *   unless it fits in one piece.
+ */
+template <
+    class T
+    , oracle::occi::Type occiT
+>
+class cLobStream
+    : public cAttr
+    , private cAttrImpl
+    , private T
+{
+private:
+    const ub4 iPieceSize_;
+    const ub1 csfrm_;
+    ub4 iMaxByteSize_;  ///< Maximum bytes per character; 1 for BLOB.
+    mutable ps::lib::sql::occi::cOciErr oOciErr_;
+    mutable std::unique_ptr<char[]> szPiece_;  ///< Holds a value which fits in one piece.
+    mutable std::string::size_type iLongest_;
+    mutable tSpill fSpill_;
+    /// Length of the body of the row measured lastly, to avoid reading it again.
+    mutable ub4 iMeasuredRow_;
+    mutable oraub8 iMeasured_;
+    mutable bool iBuffered_;  ///< true if the body is held in szPiece_.
+    OCILobLocator* oLocatorAt(const ub4& iRow) const
+    {
+        return static_cast<OCILobLocator **>(data_)[iRow];
+    }
+    void vAllocMemory()
+    {
+        cAttrImpl::vAllocMemory();
+        for (uint32_t i = 0; i < iBulkSize_; ++i)
         {
-            oRowBuf[iRow] += T::sRowHeader(oss, iDigit, rTable_[iRow].iTextLen);
-            oDelim.vUnCls(
-                oRowBuf[iRow]
-                , rTable_[iRow].szText
-                , rTable_[iRow].iTextLen
-                , rTable_[iRow].iTextInd
-                , false
+            ps::lib::sql::occi::vDescriptorAlloc(
+                oOciErr_, (dvoid **) &((OCILobLocator **) data_)[i], OCI_DTYPE_LOB
             );
-            oss.str("");
         }
     }
+    /**
+     * @brief
+     *   Returns the length in bytes of the value of iRow.
+     */
+    oraub8 iMeasure(const ub4& iRow) const
+    {
+        if (static_cast<ps::lib::sql::ind_t>(ind_[iRow]) != ps::lib::sql::ind_t::VAL_IS_NOTNULL)
+        {
+            return 0;
+        }
+        if (iMeasuredRow_ == iRow)
+        {
+            return iMeasured_;
+        }
+        iMeasuredRow_ = iRow;
+        iBuffered_ = false;
+        if (iMaxByteSize_ == 1)
+        {
+            iMeasured_ = ps::lib::sql::occi::iLobGetLength(oOciStmt_, oLocatorAt(iRow));
+            return iMeasured_;
+        }
+        // The first piece is kept, so that a short value is read only once.
+        iMeasured_ = 0;
+        oraub8 iRead = 0;
+        ub1 piece = OCI_FIRST_PIECE;
+        bool iMore = true;
+        for (auto i = 0; iMore; ++i, piece = OCI_NEXT_PIECE)
+        {
+            iMore = ps::lib::sql::occi::iLobRead(
+                oOciStmt_, oLocatorAt(iRow), csfrm_, szPiece_.get(), iPieceSize_, piece, iRead
+            );
+            iMeasured_ += iRead;
+            iBuffered_ = ! i && ! iMore;
+        }
+        return iMeasured_;
+    }
+    void vSpillIfLarge(ps::lib::cSlab& oSlab) const
+    {
+        if (fSpill_ && oSlab.size() >= iPieceSize_)
+        {
+            fSpill_(oSlab);
+        }
+    }
+    /**
+     * @brief
+     *   Reads the value of iRow straight into oSlab piece by piece.
+     */
+    void vStream(ps::lib::cSlab& oSlab, const ub4& iRow, const oraub8& iLength) const
+    {
+        if (iBuffered_)
+        {
+            oSlab.append(szPiece_.get(), iLength);
+            vSpillIfLarge(oSlab);
+            return;
+        }
+        oraub8 iTotal = 0;
+        oraub8 iRead = 0;
+        ub1 piece = OCI_FIRST_PIECE;
+        for (bool iMore = true; iMore; piece = OCI_NEXT_PIECE)
+        {
+            const auto iHead = oSlab.size();
+            iMore = ps::lib::sql::occi::iLobRead(
+                oOciStmt_, oLocatorAt(iRow), csfrm_
+                , oSlab.szReserve(iPieceSize_), iPieceSize_, piece, iRead
+            );
+            oSlab.vTruncate(iHead + iRead);
+            iTotal += iRead;
+            vSpillIfLarge(oSlab);
+        }
+        ASSERT_OR_RAISE(iTotal == iLength, std::runtime_error, boost::format
+            ("%s; %s: Length of the value has changed while reading, %d -> %d bytes.")
+                % sClass(ps::lib::E) % sName_ % iLength % iTotal);
+    }
+public:
+    cLobStream(
+        ps::lib::sql::occi::cOciStmt& oOciStmt
+        , const uint32_t& pos
+        , const oracle::occi::Type& dType
+        , const std::string& sName
+        , const oracle::occi::MetaData& meta
+        , const uint32_t& iBulkSize
+    )
+        : cAttrImpl(oOciStmt, pos, dType, sName, meta, iBulkSize)
+        , iPieceSize_(conf_.as<int32_t>("lob_piece_size"))
+        , csfrm_(static_cast<ub1>(meta.getInt(oracle::occi::MetaData::ATTR_CHARSET_FORM)))
+        , iMaxByteSize_(1)
+        , szPiece_(new char[iPieceSize_])
+        , iLongest_(0)
+        , iMeasuredRow_(UB4MAXVAL)
+        , iMeasured_(0)
+        , iBuffered_(false)
+    {
+        size_ = sizeof(OCILobLocator *);
+        iWidth_ = size_; // iWidth_ will never used.
+        sType_ = occiT == oracle::occi::OCCI_SQLT_BLOB ? "BLOB" : "CLOB";
+        type_ = occiT;
+    }
+    virtual ~cLobStream()
+    {
+        if (dataSets_)
+        {
+            for (uint32_t i = 0; i < iBulkSize_; ++i)
+            {
+                ps::lib::sql::occi::vDescriptorFree(
+                    oOciErr_, ((OCILobLocator **) dataSets_)[i], OCI_DTYPE_LOB
+                );
+            }
+        }
+#ifndef NDEBUG
+        trc_ << boost::format("%s; %s") % __PRETTY_FUNCTION__ % sName_ << std::endl;
+#endif
+    }
+    virtual void vSetDataBuffer(ps::lib::sql::occi::cDefine& oDefine)
+    {
+        if (occiT != oracle::occi::OCCI_SQLT_BLOB)
+        {
+            iMaxByteSize_ = ps::lib::sql::occi::iNlsMaxByteSize(oOciErr_, csfrm_);
+        }
+        vAllocMemory();
+        cAttrImpl::vSetDataBuffer(oDefine);
+    }
+    virtual std::string sGetFieldName() const {return cAttrImpl::sGetFieldName(); }
+    virtual std::string sGetFieldForCtrl(const ps::lib::cDelimiter& oDelim) const
+    {
+        return ps::lib::sMakeEnclosedName(sName_, MINIMUM_CTRFLD_LENGTH) + " "
+            + T::sGetLdrField(iLongest_);
+        ;
+    }
+    virtual int32_t iGetBufMemSize() const
+    {
+        // The locators, a piece held and a piece being read into the slab.
+        return cAttrImpl::iGetBufMemSize() + iPieceSize_ * 2;
+    }
+    virtual void vBeginBulk(const ub4& iNumIter) const
+    {
+        iMeasuredRow_ = UB4MAXVAL;
+    }
+    virtual void vAppendTo(
+        ps::lib::cSlab& oSlab
+        , const ub4& iRow
+        , const bool& iSep
+        , const ps::lib::cDelimiter& oDelim
+    ) const
+    {
+        iAppendHeaderTo(oSlab, iRow, oDelim);
+        vAppendBodyTo(oSlab, iRow);
+    }
+    virtual oraub8 iAppendHeaderTo(
+        ps::lib::cSlab& oSlab
+        , const ub4& iRow
+        , const ps::lib::cDelimiter& oDelim
+    ) const
+    {
+        const auto iLength = iMeasure(iRow);
+        T::vPutRowHeader(oSlab, oDelim.iGetVarDigit(), iLength);
+        return iLength;
+    }
+    virtual void vAppendBodyTo(ps::lib::cSlab& oSlab, const ub4& iRow) const
+    {
+        // The length measured by iAppendHeaderTo is reused.
+        const auto iLength = iMeasure(iRow);
+        if (iLength)
+        {
+            vStream(oSlab, iRow, iLength);
+            iLongest_ = std::max<std::string::size_type>(iLongest_, iLength);
+        }
+        iMeasuredRow_ = UB4MAXVAL;
+    }
+    virtual void vSetSpill(const tSpill& fSpill) const { fSpill_ = fSpill; }
+    virtual bool iIsStreamed() const { return true; }
     virtual std::string sGetFieldType() const { return cAttrImpl::sGetFieldType(); }
 };
 
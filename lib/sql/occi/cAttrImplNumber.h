@@ -237,25 +237,34 @@ public:
         vAllocMemory();
         cAttrImpl::vSetDataBuffer(oDefine);
     }
-    virtual void vConvertStringVct(
-        ps::lib::str_vct& oRowBuf
-        , const ub4& iNumIter
+    virtual void vAppendTo(
+        ps::lib::cSlab& oSlab
+        , const ub4& iRow
         , const bool& iSep
         , const ps::lib::cDelimiter& oDelim
     ) const
     {
-        std::string sBuf;
-        for (ub4 iRow = 0; iRow < iNumIter; ++iRow)
-        {
-            oDelim.vUnCls(
-                oRowBuf[iRow]
-                , sBuf.assign(static_cast<char *>(data_) + (size_ * iRow), length_[iRow])
-                , static_cast<ps::lib::sql::ind_t>(ind_[iRow])
-                , iSep
-            );
-        }
+        oDelim.vUnCls(
+            oSlab
+            , static_cast<char *>(data_) + (size_ * iRow), length_[iRow]
+            , static_cast<ps::lib::sql::ind_t>(ind_[iRow])
+            , iSep
+        );
+    }
+    virtual bool iGetView(tView& oView) const
+    {
+        cAttrImpl::iGetView(oView);
+        oView.iEnclose_ = false; // Numbers are not enclosed.
+        return true;
     }
     virtual std::string sGetFieldType() const { return cAttrImpl::sGetFieldType(); }
+    virtual bool iCanRotateBuffers() const { return true; }
+    virtual void vSetNumBufferSets(const uint32_t& iNumSets) { cAttrImpl::vSetNumBufferSets(iNumSets); }
+    virtual void vChangeDataBuffer(
+        ps::lib::sql::occi::cDefine& oDefine
+        , const uint32_t& iSet
+    ) const { cAttrImpl::vChangeDataBuffer(oDefine, iSet); }
+    virtual void vSelectBufferSet(const uint32_t& iSet) { cAttrImpl::vSelectBufferSet(iSet); }
 };
 
 class cOtherNumber /* For numeric in high precision or real number. */
@@ -265,10 +274,52 @@ class cOtherNumber /* For numeric in high precision or real number. */
 {
 private:
     typedef OCINumber tValueType;
+    enum tMode
+    { iOci     /* Every value is converted by OCINumberToText. */
+    , iNative  /* Every value is converted by cNumberDecoder. */
+    , iVerify  /* Same as iNative, but sampled values are compared with OCINumberToText. */
+    };
+    enum { NUM_VERIFY_INTERVAL = 64 }; ///< One of this number of values is verified.
     sb4 iPrtSize_;
     std::string sNumFmt_;
-    char *szBuffer_;
+    cConvertedText oText_;             ///< Texts converted from one bulk.
+    cNumberDecoder oDecoder_;
+    mutable tMode iMode_;
+    mutable uint64_t iNumDecoded_;
     mutable ps::lib::sql::occi::cOciErr oOciErr_;
+    /**
+     * @brief
+     *   Converts a value by OCINumberToText.
+     */
+    void vToTextByOci(const tValueType* val, char* szBuffer, ub4& iBuffer) const
+    {
+        iBuffer = iPrtSize_;
+        ps::lib::sql::occi::vNumberToText(oOciErr_, val, sNumFmt_, szBuffer, iBuffer);
+    }
+    /**
+     * @brief
+     * - Compares a text made by cNumberDecoder with OCINumberToText.
+     * - When they differ, the text is replaced with the one of OCINumberToText,
+     *   and cNumberDecoder is no longer used for this column.
+     */
+    void vVerify(const tValueType* val, char* szBuffer, ub4& iBuffer) const
+    {
+        std::vector<char> oExpected(iPrtSize_ + 1);
+        ub4 iExpected;
+        vToTextByOci(val, oExpected.data(), iExpected);
+        if (iExpected != iBuffer || ::memcmp(oExpected.data(), szBuffer, iBuffer))
+        {
+            mos_ << boost::format(
+                "%s; NUMBER decoder mismatch, native=\"%s\" oci=\"%s\" format=\"%s\"."
+                " OCINumberToText is used from now on.")
+                % sName_ % std::string(szBuffer, iBuffer)
+                % std::string(oExpected.data(), iExpected) % sNumFmt_
+                << std::endl;
+            ::memcpy(szBuffer, oExpected.data(), iExpected);
+            iBuffer = iExpected;
+            iMode_ = iOci;
+        }
+    }
 public:
     cOtherNumber(
         ps::lib::sql::occi::cOciStmt& oOciStmt
@@ -280,19 +331,44 @@ public:
     )
         : cAttrImpl(oOciStmt, pos, dType, sName, meta, iBulkSize)
         , cNumberImpl(cAttrImpl::dPrecision_, cAttrImpl::dScale_)
-        , iPrtSize_(0), sNumFmt_(""), szBuffer_(0)
+        , iPrtSize_(iGetPrtSize())
+        , sNumFmt_(sMakeNumFmt())
+        , oDecoder_(sNumFmt_)
+        , iMode_(iOci)
+        , iNumDecoded_(0)
     {
         type_ = oracle::occi::OCCI_SQLT_VNU;
         size_ = sizeof(tValueType);
-        iPrtSize_ = iGetPrtSize();
-        sNumFmt_ = sMakeNumFmt();
         iWidth_ = iPrtSize_;
         sType_ = "DECIMAL EXTERNAL";
-        szBuffer_ = new char[iPrtSize_ + 1];
+        oText_.vAlloc(iPrtSize_ + 1, iBulkSize);
+        const auto& sMode = cAttrImpl::conf_.as<std::string>("number_decoder");
+        if (sMode != "oci")
+        {
+            if (oDecoder_.iIsSupported())
+            {
+                iMode_ = sMode == "native" ? iNative : iVerify;
+            }
+            else if (boost::algorithm::icontains(sNumFmt_, "G") || boost::algorithm::icontains(sNumFmt_, "D"))
+            {
+                // Reported once, because fpnumfmt is given to every column of FLOAT.
+                static std::once_flag oOnce;
+                std::call_once(oOnce, [this]{
+                    mos_ << boost::format(
+                        "Format \"%s\" has G or D, which depend on NLS_NUMERIC_CHARACTERS."
+                        " Those NUMBER columns are converted by OCINumberToText.")
+                        % sNumFmt_ << std::endl;
+                });
+            }
+            else
+            {
+                trc_ << boost::format("%s; Format \"%s\" is not supported by the NUMBER decoder.")
+                    % sName_ % sNumFmt_ << std::endl;
+            }
+        }
     }
     virtual ~cOtherNumber()
     {
-        if (szBuffer_) delete [] szBuffer_;
 #ifndef NDEBUG
         trc_ << boost::format("%s; %s") % __PRETTY_FUNCTION__ % sName_ << std::endl;
 #endif
@@ -310,44 +386,64 @@ public:
         ;
     }
     virtual int32_t iGetBufMemSize() const { return cAttrImpl::iGetBufMemSize(); }
-    virtual void vConvertStringVct(
-        ps::lib::str_vct& oRowBuf
-        , const ub4& iNumIter
-        , const bool& iSep
-        , const ps::lib::cDelimiter& oDelim
-    ) const
+    /**
+     * @brief
+     *   Converts all values of the bulk into oText_ at once.
+     */
+    virtual void vBeginBulk(const ub4& iNumIter) const
     {
-        std::string sBuf;
-        for (ub4 iRow = 0; iRow < iNumIter; ++iRow)
+        const auto* vals = static_cast<const tValueType*>(data_);
+        for (auto iRow = 0u; iRow < iNumIter; ++iRow)
         {
+            if (static_cast<ps::lib::sql::ind_t>(ind_[iRow]) != ps::lib::sql::ind_t::VAL_IS_NOTNULL)
+            {
+                oText_.iLengthAt(iRow) = 0;
+                continue;
+            }
+            char* szBuffer = oText_.szAt(iRow);
             ub4 iBuffer = iPrtSize_;
-            ps::lib::sql::ind_t ind = static_cast<ps::lib::sql::ind_t>(ind_[iRow]);
-            if (ind == ps::lib::sql::ind_t::VAL_IS_NOTNULL)
+            if (iMode_ == iOci || ! oDecoder_.iToText(&vals[iRow], szBuffer, iBuffer))
             {
-                ps::lib::sql::occi::vNumberToText(
-                    oOciErr_, &static_cast<tValueType*>(data_)[iRow], sNumFmt_
-                    , szBuffer_, iBuffer
-                );
-                if (szBuffer_[iBuffer - 1] == '.')
-                {
-                    szBuffer_[iBuffer - 1] = '\0';
-                    --iBuffer;
-                }
+                vToTextByOci(&vals[iRow], szBuffer, iBuffer);
             }
-            else
+            else if (iMode_ == iVerify && iNumDecoded_++ % NUM_VERIFY_INTERVAL == 0)
             {
-                szBuffer_[0] = '\0';
-                iBuffer = 0;
+                vVerify(&vals[iRow], szBuffer, iBuffer);
             }
-            oDelim.vUnCls(
-                oRowBuf[iRow]
-                , sBuf.assign(szBuffer_, iBuffer)
-                , ind
-                , iSep
-            );
+            if (iBuffer && szBuffer[iBuffer - 1] == '.')
+            {
+                --iBuffer;
+            }
+            oText_.iLengthAt(iRow) = iBuffer;
         }
     }
+    virtual void vAppendTo(
+        ps::lib::cSlab& oSlab
+        , const ub4& iRow
+        , const bool& iSep
+        , const ps::lib::cDelimiter& oDelim
+    ) const
+    {
+        oDelim.vUnCls(
+            oSlab
+            , oText_.szAt(iRow), oText_.iLengthAt(iRow)
+            , static_cast<ps::lib::sql::ind_t>(ind_[iRow])
+            , iSep
+        );
+    }
+    virtual bool iGetView(tView& oView) const
+    {
+        oText_.vGetView(ind_, false, oView); // Numbers are not enclosed.
+        return true;
+    }
     virtual std::string sGetFieldType() const { return cAttrImpl::sGetFieldType(); }
+    virtual bool iCanRotateBuffers() const { return true; }
+    virtual void vSetNumBufferSets(const uint32_t& iNumSets) { cAttrImpl::vSetNumBufferSets(iNumSets); }
+    virtual void vChangeDataBuffer(
+        ps::lib::sql::occi::cDefine& oDefine
+        , const uint32_t& iSet
+    ) const { cAttrImpl::vChangeDataBuffer(oDefine, iSet); }
+    virtual void vSelectBufferSet(const uint32_t& iSet) { cAttrImpl::vSelectBufferSet(iSet); }
 };
 
 } // ps::lib::sql::occi::nsReprVar
@@ -42,6 +42,24 @@ class cTimestamp
 {
 private:
     std::string sMask_;
+    cDateFormatter oFormatter_;
+    ub4 iDescType_;         ///< Type of the descriptors when they are fetched in binary, otherwise 0.
+    cConvertedText oText_;  ///< Texts formatted from one bulk.
+    mutable ps::lib::sql::occi::cOciErr oOciErr_;
+    void vAllocMemory()
+    {
+        cAttrImpl::vAllocMemory();
+        if (iDescType_)
+        {
+            // Every buffer set has own descriptors.
+            for (uint32_t i = 0; i < iBulkSize_ * iNumSets_; ++i)
+            {
+                ps::lib::sql::occi::vDescriptorAlloc(
+                    oOciErr_, (dvoid **) &((OCIDateTime **) dataSets_)[i], iDescType_
+                );
+            }
+        }
+    }
 public:
     cTimestamp(
         ps::lib::sql::occi::cOciStmt& oOciStmt
@@ -55,14 +73,51 @@ public:
     )
         : cAttrImpl(oOciStmt, pos, dType, sName, meta, iBulkSize)
         , sMask_(sMask)
+        , oFormatter_(sMask_, dScale_)
+        , iDescType_(0)
     {
         size_ = sMask_.size() + dScale_;
         iWidth_ = size_;
         sType_ = szDataType;
         type_ = oracle::occi::OCCI_SQLT_CHR;
+        if (conf_.as<bool>("native_datetime"))
+        {
+            /*
+             * TIMESTAMP WITH LOCAL TIME ZONE is left to the server,
+             * because it is converted to the time zone of the session.
+             */
+            if (! oFormatter_.iIsSupported())
+            {
+                trc_ << boost::format("%s; Mask \"%s\" is not supported by the client-side formatter.")
+                    % sName_ % sMask_ << std::endl;
+            }
+            else if (dType_ == oracle::occi::OCCI_SQLT_TIMESTAMP)
+            {
+                iDescType_ = OCI_DTYPE_TIMESTAMP;
+            }
+            else if (dType_ == oracle::occi::OCCI_SQLT_TIMESTAMP_TZ)
+            {
+                iDescType_ = OCI_DTYPE_TIMESTAMP_TZ;
+            }
+        }
+        if (iDescType_)
+        {
+            size_ = sizeof(OCIDateTime *);
+            type_ = dType_;
+            oText_.vAlloc(oFormatter_.iGetMaxLength(), iBulkSize);
+        }
     }
     virtual ~cTimestamp()
     {
+        if (iDescType_ && dataSets_)
+        {
+            for (uint32_t i = 0; i < iBulkSize_ * iNumSets_; ++i)
+            {
+                ps::lib::sql::occi::vDescriptorFree(
+                    oOciErr_, ((OCIDateTime **) dataSets_)[i], iDescType_
+                );
+            }
+        }
 #ifndef NDEBUG
         trc_ << boost::format("%s; %s") % __PRETTY_FUNCTION__ % sName_ << std::endl;
 #endif
@@ -82,13 +137,76 @@ public:
         ;
     }
     virtual int32_t iGetBufMemSize() const { return cAttrImpl::iGetBufMemSize(); }
-    virtual void vConvertStringVct(
-        ps::lib::str_vct& oRowBuf
-        , const ub4& iNumIter
+    /**
+     * @brief
+     *   Formats all values of the bulk into oText_ at once, if they were fetched in binary.
+     */
+    virtual void vBeginBulk(const ub4& iNumIter) const
+    {
+        if (! iDescType_)
+        {
+            return;
+        }
+        const bool iNeedsTimeZone = oFormatter_.iNeedsTimeZone();
+        cDateFormatter::tDateTime t = {};
+        for (auto iRow = 0u; iRow < iNumIter; ++iRow)
+        {
+            if (static_cast<ps::lib::sql::ind_t>(ind_[iRow]) != ps::lib::sql::ind_t::VAL_IS_NOTNULL)
+            {
+                oText_.iLengthAt(iRow) = 0;
+                continue;
+            }
+            OCIDateTime* val = static_cast<OCIDateTime **>(data_)[iRow];
+            ps::lib::sql::occi::vDateTimeGetDateTime(
+                oOciErr_, val, &t.iYear_, &t.iMonth_, &t.iDay_
+                , &t.iHour_, &t.iMinute_, &t.iSecond_, &t.iNanoSec_
+            );
+            if (iNeedsTimeZone)
+            {
+                ps::lib::sql::occi::vDateTimeGetTimeZoneOffset(
+                    oOciErr_, val, &t.iTzHour_, &t.iTzMinute_
+                );
+            }
+            oText_.iLengthAt(iRow) = oFormatter_.iFormat(t, oText_.szAt(iRow));
+        }
+    }
+    virtual void vAppendTo(
+        ps::lib::cSlab& oSlab
+        , const ub4& iRow
         , const bool& iSep
         , const ps::lib::cDelimiter& oDelim
-    ) const { cAttrImpl::vConvertStringVct(oRowBuf, iNumIter, iSep, oDelim); }
+    ) const
+    {
+        if (iDescType_)
+        {
+            oDelim.vEnCls(
+                oSlab, oText_.szAt(iRow), oText_.iLengthAt(iRow)
+                , static_cast<ps::lib::sql::ind_t>(ind_[iRow]), iSep
+            );
+        }
+        else
+        {
+            cAttrImpl::vAppendTo(oSlab, iRow, iSep, oDelim);
+        }
+    }
+    virtual void vEndBulk(const ub4& iNumIter) const { cAttrImpl::vEndBulk(); }
+    virtual bool iGetView(tView& oView) const
+    {
+        if (iDescType_)
+        {
+            oText_.vGetView(ind_, true, oView);
+            return true;
+        }
+        return cAttrImpl::iGetView(oView);
+    }
     virtual std::string sGetFieldType() const { return cAttrImpl::sGetFieldType(); }
+    virtual bool iCanRotateBuffers() const { return true; }
+    virtual void vSetNumBufferSets(const uint32_t& iNumSets) { cAttrImpl::vSetNumBufferSets(iNumSets); }
+    virtual void vChangeDataBuffer(
+        ps::lib::sql::occi::cDefine& oDefine
+        , const uint32_t& iSet
+    ) const { cAttrImpl::vChangeDataBuffer(oDefine, iSet); }
+    virtual void vSelectBufferSet(const uint32_t& iSet) { cAttrImpl::vSelectBufferSet(iSet); }
 };
 
 } // ps::lib::sql::occi::nsReprVar
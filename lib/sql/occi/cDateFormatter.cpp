@@ -0,0 +1,269 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <pslib.h>
+
+namespace ps
+{
+
+namespace lib
+{
+
+namespace sql
+{
+
+namespace occi
+{
+
+namespace
+{
+
+/**
+ * @brief
+ *   "00", "01", ... "99" placed contiguously.
+ */
+struct tDigitPairs
+{
+    char s_[200];
+    tDigitPairs()
+    {
+        for (auto i = 0; i < 100; ++i)
+        {
+            s_[i * 2] = '0' + i / 10;
+            s_[i * 2 + 1] = '0' + i % 10;
+        }
+    }
+};
+
+const tDigitPairs oPairs;
+
+inline char* szPutPair(char* q, const uint32_t& i)
+{
+    BOOST_ASSERT(i < 100);
+    q[0] = oPairs.s_[i * 2];
+    q[1] = oPairs.s_[i * 2 + 1];
+    return q + 2;
+}
+
+} // anonymous
+
+cDateFormatter::cDateFormatter(const std::string& sMask, const int32_t& iScale)
+    : iSupported_(false)
+    , iNeedsTimeZone_(false)
+    , iMaxLength_(0)
+{
+    static const std::string sPunctuations = "-/,.;: ";
+    // Elements of the mask which are looked up in this order.
+    static const struct
+    {
+        const char* szName_;
+        tKind iKind_;
+        int32_t iArg_;
+    } oElements[] = {
+        {"YYYY", iYear4, 0}, {"HH24", iHour24, 0}, {"HH12", iHour12, 0}
+        , {"A.M.", iMeridianDot, 0}, {"P.M.", iMeridianDot, 0}
+        , {"TZH", iTzHour, 0}, {"TZM", iTzMinute, 0}
+        , {"FF1", iFraction, 1}, {"FF2", iFraction, 2}, {"FF3", iFraction, 3}
+        , {"FF4", iFraction, 4}, {"FF5", iFraction, 5}, {"FF6", iFraction, 6}
+        , {"FF7", iFraction, 7}, {"FF8", iFraction, 8}, {"FF9", iFraction, 9}
+        , {"FF", iFraction, -1}
+        , {"YY", iYear2, 0}, {"MM", iMonth, 0}, {"MI", iMinute, 0}, {"DD", iDay, 0}
+        , {"HH", iHour12, 0}, {"SS", iSecond, 0}, {"AM", iMeridian, 0}, {"PM", iMeridian, 0}
+    };
+    const auto sUpper = boost::to_upper_copy(sMask);
+    auto i = 0u;
+    while (i < sUpper.size())
+    {
+        tOp oOp = {iLiteral, 0, ""};
+        if (sUpper[i] == '"')
+        {
+            const auto j = sUpper.find('"', i + 1);
+            if (j == std::string::npos)
+            {
+                return;
+            }
+            oOp.sLiteral_ = sMask.substr(i + 1, j - i - 1);
+            i = j + 1;
+        }
+        else if (sUpper[i] == 'X')
+        {
+            oOp.sLiteral_ = "."; // The radix character.
+            ++i;
+        }
+        else
+        {
+            bool iFound = false;
+            for (const auto& e: oElements)
+            {
+                if (sUpper.compare(i, ::strlen(e.szName_), e.szName_) == 0)
+                {
+                    oOp.iKind_ = e.iKind_;
+                    oOp.iArg_ = e.iArg_;
+                    i += ::strlen(e.szName_);
+                    iFound = true;
+                    break;
+                }
+            }
+            if (! iFound)
+            {
+                if (sPunctuations.find(sUpper[i]) == std::string::npos)
+                {
+                    return; // Not supported.
+                }
+                oOp.sLiteral_ = sMask.substr(i, 1);
+                ++i;
+            }
+        }
+        switch (oOp.iKind_)
+        {
+        case iLiteral:
+            iMaxLength_ += oOp.sLiteral_.size();
+            break;
+        case iYear4:
+            iMaxLength_ += 4;
+            break;
+        case iFraction:
+            if (oOp.iArg_ < 0)
+            {
+                if (iScale <= 0)
+                {
+                    return; // Not supported.
+                }
+                oOp.iArg_ = iScale;
+            }
+            iMaxLength_ += oOp.iArg_;
+            break;
+        case iTzHour:
+            iNeedsTimeZone_ = true;
+            iMaxLength_ += 3;
+            break;
+        case iTzMinute:
+            iNeedsTimeZone_ = true;
+            iMaxLength_ += 2;
+            break;
+        case iMeridianDot:
+            iMaxLength_ += 4;
+            break;
+        default:
+            iMaxLength_ += 2;
+            break;
+        }
+        oOps_.push_back(oOp);
+    }
+    iSupported_ = true;
+}
+
+size_t cDateFormatter::iFormat(const tDateTime& t, char* szBuffer) const
+{
+    BOOST_ASSERT(iSupported_);
+    static const uint32_t iPow10[] = {
+        1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+    };
+    auto q = szBuffer;
+    const uint32_t iYear = std::abs(t.iYear_); // Years of B.C. are printed without sign.
+    for (const auto& oOp: oOps_)
+    {
+        switch (oOp.iKind_)
+        {
+        case iLiteral:
+            ::memcpy(q, oOp.sLiteral_.data(), oOp.sLiteral_.size());
+            q += oOp.sLiteral_.size();
+            break;
+        case iYear4:
+            q = szPutPair(q, iYear / 100 % 100);
+            q = szPutPair(q, iYear % 100);
+            break;
+        case iYear2:
+            q = szPutPair(q, iYear % 100);
+            break;
+        case iMonth:
+            q = szPutPair(q, t.iMonth_);
+            break;
+        case iDay:
+            q = szPutPair(q, t.iDay_);
+            break;
+        case iHour24:
+            q = szPutPair(q, t.iHour_);
+            break;
+        case iHour12:
+            q = szPutPair(q, t.iHour_ % 12 ? t.iHour_ % 12 : 12);
+            break;
+        case iMinute:
+            q = szPutPair(q, t.iMinute_);
+            break;
+        case iSecond:
+            q = szPutPair(q, t.iSecond_);
+            break;
+        case iFraction:
+            {
+                // Digits beyond the precision are truncated.
+                auto iValue = t.iNanoSec_ / iPow10[9 - oOp.iArg_];
+                for (auto k = oOp.iArg_ - 1; k >= 0; --k)
+                {
+                    q[k] = '0' + iValue % 10;
+                    iValue /= 10;
+                }
+                q += oOp.iArg_;
+            }
+            break;
+        case iTzHour:
+            *q++ = (t.iTzHour_ < 0 || t.iTzMinute_ < 0) ? '-' : '+';
+            q = szPutPair(q, std::abs(t.iTzHour_));
+            break;
+        case iTzMinute:
+            q = szPutPair(q, std::abs(t.iTzMinute_));
+            break;
+        case iMeridian:
+            *q++ = t.iHour_ < 12 ? 'A' : 'P';
+            *q++ = 'M';
+            break;
+        case iMeridianDot:
+            *q++ = t.iHour_ < 12 ? 'A' : 'P';
+            *q++ = '.';
+            *q++ = 'M';
+            *q++ = '.';
+            break;
+        }
+    }
+    return q - szBuffer;
+}
+
+void cDateFormatter::vFromOciDate(const ub1* p, tDateTime& t)
+{
+    // Century and year are stored in excess-100 notation.
+    t.iYear_ = (static_cast<int32_t>(p[0]) - 100) * 100 + (static_cast<int32_t>(p[1]) - 100);
+    t.iMonth_ = p[2];
+    t.iDay_ = p[3];
+    t.iHour_ = p[4] - 1;
+    t.iMinute_ = p[5] - 1;
+    t.iSecond_ = p[6] - 1;
+    t.iNanoSec_ = 0;
+    t.iTzHour_ = 0;
+    t.iTzMinute_ = 0;
+}
+
+} // ps::lib::sql::occi
+
+} // ps::lib::sql
+
+} // ps::lib
+
+} // ps
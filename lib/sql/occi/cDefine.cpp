@@ -205,6 +205,18 @@ void cDefine::vAddItem(
     );
 }
 
+void cDefine::vChangeAddr(
+    const int32_t i
+    , void *valuep
+    , int32_t value_sz
+    , ps::lib::sql::ind_t *indp
+    , uint16_t *rlenp
+    , uint16_t *rcodep
+){
+    BOOST_ASSERT(iTiming_ == tTiming::iOnce);
+    oMap_.at(i - 1).oAssign(valuep, value_sz, indp, rlenp, rcodep);
+}
+
 void cDefine::vAttachTo(cOciStmt& oOciStmt)
 {
     BOOST_ASSERT(oMap_.size());
@@ -0,0 +1,229 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <pslib.h>
+
+namespace ps
+{
+
+namespace lib
+{
+
+namespace sql
+{
+
+namespace occi
+{
+
+namespace
+{
+
+const sb2 iNotNull = static_cast<sb2>(ps::lib::sql::ind_t::VAL_IS_NOTNULL);
+
+} // anonymous
+
+cEncoderPlan::cEncoderPlan(
+    const cAttr::tContainer& oAttrs
+    , const ps::lib::cDelimiter& oDelim
+    , const std::string& tag
+)
+    : oDelim_(oDelim)
+    , sOpen_(oDelim.sGetOpenEnclosure(ps::lib::cDelimiter::iData))
+    , sClose_(oDelim.sGetCloseEnclosure(ps::lib::cDelimiter::iData))
+    , sColSep_(oDelim.sGetColSeparator(ps::lib::cDelimiter::iData))
+    , sTail_(
+        oDelim.sGetLastSeparator(ps::lib::cDelimiter::iData)
+        + oDelim.sGetRowSeparator(ps::lib::cDelimiter::iData)
+    )
+    , iVarDigit_(oDelim.iGetVarDigit())
+    , iNumStreamed_(0)
+{
+    BOOST_ASSERT(oAttrs.size());
+    static const tFp fpTable[] = {
+        &cEncoderPlan::vEncodeRows<false, false, false>
+        , &cEncoderPlan::vEncodeRows<false, false, true>
+        , &cEncoderPlan::vEncodeRows<false, true, false>
+        , &cEncoderPlan::vEncodeRows<false, true, true>
+        , &cEncoderPlan::vEncodeRows<true, false, false>
+        , &cEncoderPlan::vEncodeRows<true, false, true>
+        , &cEncoderPlan::vEncodeRows<true, true, false>
+        , &cEncoderPlan::vEncodeRows<true, true, true>
+    };
+    const bool iEnclose = !sOpen_.empty() || !sClose_.empty();
+    fpEncode_ = fpTable[
+        (iEnclose ? 4 : 0) + (iVarDigit_ ? 2 : 0) + (sColSep_.size() == 1 ? 1 : 0)
+    ];
+    auto iNumCopies = 0;
+    for (const auto& oAttr: oAttrs)
+    {
+        tOp oOp;
+        oOp.oAttr_ = &oAttr;
+        oOp.iCopy_ = oAttr.iGetView(oOp.oView_);
+        oOp.iStreamed_ = ! oOp.iCopy_ && oAttr.iIsStreamed();
+        iNumCopies += oOp.iCopy_;
+        iNumStreamed_ += oOp.iStreamed_;
+        oOps_.push_back(oOp);
+    }
+    ps::lib::cTracer::get_mutable_instance() << boost::format(
+        "%s; Encoder plan: %d column(s), %d copied directly, %d streamed, enclose=%d, var digit=%d")
+        % tag % oOps_.size() % iNumCopies % iNumStreamed_ % iEnclose % iVarDigit_
+        << std::endl;
+}
+
+void cEncoderPlan::vEncode(ps::lib::cSlab& oSlab, const ub4& iNumIter)
+{
+    BOOST_ASSERT(iNumIter);
+    for (auto& oOp: oOps_)
+    {
+        if (oOp.iCopy_)
+        {
+            // The define-buffer set may have been rotated since the last bulk.
+            oOp.oAttr_->iGetView(oOp.oView_);
+        }
+        oOp.oAttr_->vBeginBulk(iNumIter);
+    }
+    (this->*fpEncode_)(oSlab, iNumIter);
+    for (const auto& oOp: oOps_)
+    {
+        oOp.oAttr_->vEndBulk(iNumIter);
+    }
+}
+
+void cEncoderPlan::vSetSpill(const cAttr::tSpill& fSpill) const
+{
+    for (const auto& oOp: oOps_)
+    {
+        if (oOp.iStreamed_)
+        {
+            oOp.oAttr_->vSetSpill(fSpill);
+        }
+    }
+}
+
+template<bool kEnclose, bool kVarDigit, bool kOneCharSep>
+void cEncoderPlan::vEncodeRows(ps::lib::cSlab& oSlab, const ub4& iNumIter) const
+{
+    for (auto iRow = 0u; iRow < iNumIter; ++iRow)
+    {
+        const auto iHeader = oSlab.size();
+        if (kVarDigit)
+        {
+            oSlab.szReserve(iVarDigit_); // The length of this row is filled in later.
+            if (iNumStreamed_)
+            {
+                // The length must be filled before the row is spilled.
+                oraub8 iBodies = 0;
+                oBodies_.clear();
+                vEncodeRow<kEnclose, kOneCharSep>(oSlab, iRow, &iBodies);
+                const auto iEnd = oSlab.size();
+                oSlab.vPatchDecimal(iHeader, iVarDigit_, iEnd - iHeader - iVarDigit_ + iBodies);
+                // Each body is streamed into its place, followed by the part of the row up to the next one.
+                const auto iFirst = oBodies_.front().iPos_;
+                sRest_.assign(oSlab.data() + iFirst, iEnd - iFirst);
+                oSlab.vTruncate(iFirst);
+                for (size_t k = 0; k < oBodies_.size(); ++k)
+                {
+                    oBodies_[k].oAttr_->vAppendBodyTo(oSlab, iRow);
+                    const auto iNext = k + 1 < oBodies_.size() ? oBodies_[k + 1].iPos_ : iEnd;
+                    oSlab.append(sRest_.data() + oBodies_[k].iPos_ - iFirst, iNext - oBodies_[k].iPos_);
+                }
+                continue;
+            }
+        }
+        vEncodeRow<kEnclose, kOneCharSep>(oSlab, iRow, nullptr);
+        if (kVarDigit)
+        {
+            oSlab.vPatchDecimal(iHeader, iVarDigit_, oSlab.size() - iHeader - iVarDigit_);
+        }
+    }
+}
+
+template<bool kEnclose, bool kOneCharSep>
+void cEncoderPlan::vEncodeRow(ps::lib::cSlab& oSlab, const ub4& iRow, oraub8* pBodies) const
+{
+    const auto iNumOps = oOps_.size();
+    const auto iOpen = sOpen_.size();
+    const auto iClose = sClose_.size();
+    for (auto i = 0u; i < iNumOps; ++i)
+    {
+        const auto& oOp = oOps_[i];
+        if (oOp.iCopy_ && oOp.oView_.fpFormat_)
+        {
+            const auto& v = oOp.oView_;
+            if (v.ind_[iRow] == iNotNull)
+            {
+                // Formatted straight into the slab.
+                const auto iHead = oSlab.size();
+                const auto iLen = v.fpFormat_(
+                    v.data_ + static_cast<size_t>(v.size_) * iRow
+                    , oSlab.szReserve(v.iMaxLength_)
+                );
+                oSlab.vTruncate(iHead + iLen);
+            }
+        }
+        else if (oOp.iCopy_)
+        {
+            const auto& v = oOp.oView_;
+            const size_t iLen = v.ind_[iRow] == iNotNull ? v.length_[iRow] : 0;
+            const char* data = v.data_ + static_cast<size_t>(v.size_) * iRow;
+            if (kEnclose && v.iEnclose_)
+            {
+                auto p = oSlab.szReserve(iOpen + iLen + iClose);
+                ::memcpy(p, sOpen_.data(), iOpen);
+                ::memcpy(p + iOpen, data, iLen);
+                ::memcpy(p + iOpen + iLen, sClose_.data(), iClose);
+            }
+            else
+            {
+                oSlab.append(data, iLen);
+            }
+        }
+        else if (pBodies && oOp.iStreamed_)
+        {
+            *pBodies += oOp.oAttr_->iAppendHeaderTo(oSlab, iRow, oDelim_);
+            oBodies_.push_back(tBody{oOp.oAttr_, oSlab.size()});
+        }
+        else
+        {
+            oOp.oAttr_->vAppendTo(oSlab, iRow, false, oDelim_);
+        }
+        if (i + 1 < iNumOps)
+        {
+            if (kOneCharSep)
+            {
+                oSlab += sColSep_[0];
+            }
+            else
+            {
+                oSlab += sColSep_;
+            }
+        }
+    }
+    oSlab += sTail_;
+}
+
+} // ps::lib::sql::occi
+
+} // ps::lib::sql
+
+} // ps::lib
+
+} // ps
@@ -0,0 +1,298 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <pslib.h>
+
+namespace ps
+{
+
+namespace lib
+{
+
+namespace sql
+{
+
+namespace occi
+{
+
+namespace
+{
+
+enum
+{ NUM_MAX_LENGTH = 21    ///< Maximum length of exponent and mantissa in bytes.
+, NUM_EXPO_BIAS = 65     ///< Bias of the exponent in base 100.
+, NUM_NEG_TERMINATOR = 102 ///< Trailing byte of a negative mantissa.
+, NUM_MAX_DIGITS = NUM_MAX_LENGTH * 2
+, NUM_MAX_TEXT = 128
+};
+
+/**
+ * @brief
+ *   Rounds half away from zero, so that iKeep digits remain.
+ *   Trailing zeros are removed from the result.
+ */
+void vRoundDigits(char* d, int32_t& nd, int32_t& iPointPos, const int32_t& iKeep)
+{
+    if (iKeep >= nd)
+    {
+        return;
+    }
+    if (iKeep < 0)
+    {
+        nd = 0;
+        iPointPos = 0;
+        return;
+    }
+    const bool iCarry = d[iKeep] >= 5;
+    nd = iKeep;
+    if (iCarry)
+    {
+        auto i = nd - 1;
+        for (; i >= 0 && d[i] == 9; --i)
+        {
+            d[i] = 0;
+        }
+        if (i >= 0)
+        {
+            ++d[i];
+        }
+        else
+        {
+            // All digits were carried over. e.g.) 9.99 -> 10.0
+            d[0] = 1;
+            nd = 1;
+            ++iPointPos;
+        }
+    }
+    while (nd > 0 && d[nd - 1] == 0)
+    {
+        --nd;
+    }
+    if (nd == 0)
+    {
+        iPointPos = 0;
+    }
+}
+
+} // anonymous
+
+cNumberDecoder::cNumberDecoder(const std::string& sNumFmt)
+    : iSupported_(false)
+    , iSci_(false)
+    , iPoint_(false)
+    , iIntDigits_(0)
+    , iMinIntDigits_(0)
+    , iFracDigits_(0)
+    , iMinFracDigits_(0)
+{
+    auto s = boost::to_upper_copy(sNumFmt);
+    // Without "fm", OCINumberToText pads the result with blanks.
+    if (! boost::starts_with(s, "FM"))
+    {
+        return;
+    }
+    s.erase(0, 2);
+    if (boost::ends_with(s, "EEEE"))
+    {
+        iSci_ = true;
+        s.erase(s.size() - 4);
+    }
+    for (const auto c: s)
+    {
+        if (c == '.')
+        {
+            if (iPoint_) return;
+            iPoint_ = true;
+        }
+        else if (c == '9' || c == '0')
+        {
+            if (iPoint_)
+            {
+                ++iFracDigits_;
+                if (c == '0') iMinFracDigits_ = iFracDigits_;
+            }
+            else
+            {
+                ++iIntDigits_;
+                if (c == '0' && iMinIntDigits_ == 0) iMinIntDigits_ = -iIntDigits_;
+            }
+        }
+        else
+        {
+            return;
+        }
+    }
+    if (iMinIntDigits_ < 0)
+    {
+        // Every position from the first '0' is printed.
+        iMinIntDigits_ = iIntDigits_ + iMinIntDigits_ + 1;
+    }
+    if (iIntDigits_ == 0 || (iSci_ && iIntDigits_ != 1))
+    {
+        return;
+    }
+    iSupported_ = true;
+}
+
+bool cNumberDecoder::iToText(const OCINumber* val, char* szBuffer, ub4& iBuffer) const
+{
+    BOOST_ASSERT(iSupported_);
+    const ub1* p = reinterpret_cast<const ub1*>(val);
+    auto iLen = static_cast<int32_t>(p[0]);
+    if (iLen < 1 || iLen > NUM_MAX_LENGTH)
+    {
+        return false;
+    }
+    const ub1 iExp = p[1];
+    const bool iNeg = (iExp & 0x80) == 0;
+    char d[NUM_MAX_DIGITS]; // decimal digits of the mantissa, 0.d[0]d[1]... x 10^iPointPos
+    int32_t nd = 0;
+    int32_t iPointPos = 0;
+    if (iLen == 1)
+    {
+        if (iExp != 0x80)
+        {
+            return false; // negative infinity.
+        }
+        // zero.
+    }
+    else
+    {
+        if (iNeg)
+        {
+            if (p[iLen] == NUM_NEG_TERMINATOR)
+            {
+                --iLen;
+            }
+            iPointPos = 2 * ((~iExp & 0x7F) - NUM_EXPO_BIAS + 1);
+        }
+        else
+        {
+            if (iExp == 0xFF)
+            {
+                return false; // positive infinity.
+            }
+            iPointPos = 2 * ((iExp & 0x7F) - NUM_EXPO_BIAS + 1);
+        }
+        for (auto i = 2; i <= iLen; ++i)
+        {
+            const int32_t m = iNeg ? 101 - p[i] : p[i] - 1;
+            if (m < 0 || m > 99)
+            {
+                return false;
+            }
+            d[nd++] = m / 10;
+            d[nd++] = m % 10;
+        }
+        auto iLead = 0;
+        while (iLead < nd && d[iLead] == 0)
+        {
+            ++iLead;
+        }
+        if (iLead)
+        {
+            ::memmove(d, d + iLead, nd - iLead);
+            nd -= iLead;
+            iPointPos -= iLead;
+        }
+        while (nd > 0 && d[nd - 1] == 0)
+        {
+            --nd;
+        }
+    }
+    char szText[NUM_MAX_TEXT];
+    auto q = szText;
+    auto iExp10 = 0;
+    if (iSci_)
+    {
+        if (nd)
+        {
+            vRoundDigits(d, nd, iPointPos, 1 + iFracDigits_);
+            iExp10 = iPointPos - 1;
+            iPointPos = 1;
+        }
+    }
+    else
+    {
+        vRoundDigits(d, nd, iPointPos, iPointPos + iFracDigits_);
+        if (nd && iPointPos > iIntDigits_)
+        {
+            return false; // OCINumberToText fills it with '#'.
+        }
+    }
+    if (nd == 0 && iNeg && iLen > 1)
+    {
+        return false; // a negative value rounded to zero.
+    }
+    if (iNeg && nd)
+    {
+        *q++ = '-';
+    }
+    // Integer part.
+    auto nInt = std::max(nd ? iPointPos : 0, iMinIntDigits_);
+    if (nInt == 0 && nd == 0)
+    {
+        nInt = 1; // zero is printed as "0."
+    }
+    for (auto k = iPointPos - nInt; k < iPointPos; ++k)
+    {
+        *q++ = '0' + (k >= 0 && k < nd ? d[k] : 0);
+    }
+    // Fraction part.
+    if (iPoint_)
+    {
+        *q++ = '.';
+        const auto nFrac = std::max(std::min(nd - iPointPos, iFracDigits_), iMinFracDigits_);
+        for (auto k = iPointPos; k < iPointPos + nFrac; ++k)
+        {
+            *q++ = '0' + (k >= 0 && k < nd ? d[k] : 0);
+        }
+    }
+    // Exponent part.
+    if (iSci_)
+    {
+        *q++ = 'E';
+        *q++ = iExp10 < 0 ? '-' : '+';
+        const auto iAbs = std::abs(iExp10);
+        if (iAbs >= 100)
+        {
+            *q++ = '0' + iAbs / 100;
+        }
+        *q++ = '0' + iAbs / 10 % 10;
+        *q++ = '0' + iAbs % 10;
+    }
+    const auto iSize = static_cast<ub4>(q - szText);
+    if (iSize > iBuffer)
+    {
+        return false;
+    }
+    ::memcpy(szBuffer, szText, iSize);
+    iBuffer = iSize;
+    return true;
+}
+
+} // ps::lib::sql::occi
+
+} // ps::lib::sql
+
+} // ps::lib
+
+} // ps
@@ -85,6 +85,8 @@ void cPieceVct::vSetAddr(
     data_ = data;
     ind_ = ind;
     length_ = length;
+    // Capacities recorded for the previous array are no longer valid.
+    oCapacity_.clear();
 }
 
 void cPieceVct::vTerminateLatest(cPieceVct *pv, const ub4& iter)
@@ -101,6 +103,27 @@ void cPieceVct::vTerminateLatest(cPieceVct *pv, const ub4& iter)
     }
 }
 
+ub4& cPieceVct::iCapacityAt(const ub4& iter)
+{
+    if (oCapacity_.size() <= iter)
+    {
+        oCapacity_.resize(iter + 1, 0);
+    }
+    return oCapacity_[iter];
+}
+
+ub4 cPieceVct::iGetFirstPieceSize() const
+{
+    // Grow toward the longest value seen so far, so that subsequent rows
+    // are usually received in one piece; bounded to avoid reserving the
+    // size of one exceptionally long value for every row of the bulk.
+    const std::string::size_type iLimit
+        = static_cast<std::string::size_type>(iPcsLen_) * PIECE_ADAPT_RATIO;
+    return static_cast<ub4>(
+        std::max<std::string::size_type>(iPcsLen_, std::min(iLongest_, iLimit))
+    );
+}
+
 sb4 cPieceVct::iCbkFunc(
     dvoid *octxp
     , OCIDefine *defnp
@@ -116,39 +139,54 @@ sb4 cPieceVct::iCbkFunc(
     BOOST_ASSERT(pv->ind_);
     BOOST_ASSERT(pv->length_);
     const size_t diff = pv->iSkip_ * iter;
-    char *data;     // Address of the start of the current piece.
-    ub4 *length;
-    char *tmp;
+    char *&data = pGetDataAddr(pv->data_, diff);
+    ub4 *length = pGetLengthAddr(pv->length_, diff);
+    ub4 &iCapacity = pv->iCapacityAt(iter);
+    ub4 iWant;      // Minimum capacity required for the next piece.
     switch (*piecep)
     {
     case OCI_ONE_PIECE:
     case OCI_FIRST_PIECE:
         if (iter) { vTerminateLatest(pv, iter); }
         pv->iNumPcs_ = 1;
-        data = pGetDataAddr(pv->data_, diff);
-        if (data) { delete [] data; }
-        *bufpp = pGetDataAddr(pv->data_, diff) =
-            new char[pv->iPcsLen_ * pv->iNumPcs_];
-        length = pGetLengthAddr(pv->length_, diff);
         *length = 0;
+        // One extra byte is kept for the terminator.
+        iWant = pv->iGetFirstPieceSize() + 1;
+        // The buffer of the row is reused across batches while it is large enough.
+        if (!data || iCapacity < iWant)
+        {
+            if (data) { delete [] data; }
+            data = new char[iWant];
+            iCapacity = iWant;
+        }
         break;
     case OCI_NEXT_PIECE:
     case OCI_LAST_PIECE:
         ++pv->iNumPcs_;
-        data = pGetDataAddr(pv->data_, diff);
-        // Resize buffer.
-        tmp = new char[pv->iPcsLen_ * pv->iNumPcs_];
-        memcpy(tmp, data, pv->iPcsLen_ * (pv->iNumPcs_ - 1));
-        delete [] data;
-        pGetDataAddr(pv->data_, diff) = tmp;
-        *bufpp = tmp + pv->iPcsLen_ * (pv->iNumPcs_ - 1);
-        length = pGetLengthAddr(pv->length_, diff);
         *length += pv->iActual_;
+        iWant = *length + pv->iPcsLen_ + 1;
+        if (iCapacity < iWant)
+        {
+            // Geometric growth keeps the total amount of copying
+            // linear in the length of the value.
+            const ub4 iNewCap = std::max(iWant
+                , static_cast<ub4>(std::min<uint64_t>(
+                    static_cast<uint64_t>(iCapacity) * 2, UB4MAXVAL
+                ))
+            );
+            char *tmp = new char[iNewCap];
+            memcpy(tmp, data, *length);
+            delete [] data;
+            data = tmp;
+            iCapacity = iNewCap;
+        }
         break;
     default:
         return OCI_ERROR;
     }
-    pv->iActual_ = pv->iPcsLen_; // Reset to maximum length.
+    *bufpp = data + *length;
+    // Offer all the remaining space of the buffer but the terminator.
+    pv->iActual_ = iCapacity - *length - 1;
     /*
      * Pass a pointer to the variable that stores the length of
      * the next piece to be fetched to the OCI.
@@ -0,0 +1,167 @@
+/*
+ *
+ * Copyright (C) 2023 SuitableApp
+ *
+ * This file is part of Extreme Unloader(XTRU).
+ *
+ * Extreme Unloader(XTRU) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Extreme Unloader(XTRU) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Extreme Unloader(XTRU).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <pslib.h>
+
+namespace ps
+{
+
+namespace lib
+{
+
+namespace sql
+{
+
+namespace occi
+{
+
+namespace
+{
+
+const char szBase64[] = {
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+};
+
+uint32_t iDecodeBase64(const std::string& sRowid, const size_t& iPos, const size_t& iLen)
+{
+    uint64_t iVal = 0;
+    for (auto i = iPos; i < iPos + iLen; ++i)
+    {
+        const auto p = ::strchr(szBase64, sRowid[i]);
+        ASSERT_OR_RAISE(sRowid[i] && p, std::runtime_error
+            , boost::format("Invalid character in ROWID \"%s\".") % sRowid
+        );
+        iVal = (iVal << 6) | static_cast<uint64_t>(p - szBase64);
+    }
+    return static_cast<uint32_t>(iVal);
+}
+
+void vEncodeBase64(std::string& sRowid, uint32_t iVal, const size_t& iLen)
+{
+    char buf[8];
+    for (auto i = iLen; i > 0; --i)
+    {
+        buf[i - 1] = szBase64[iVal & 0x3f];
+        iVal >>= 6;
+    }
+    sRowid.append(buf, iLen);
+}
+
+} // ps::lib::sql::occi::<anonymous>
+
+const char cRowidSplitter::szQuery[] = {"SELECT * FROM %s WHERE ROWID BETWEEN '%s' AND '%s'"};
+
+cRowidSplitter::tRowid cRowidSplitter::tRowid::oDecode(const std::string& sRowid)
+{
+    ASSERT_OR_RAISE(sRowid.size() == 18, std::runtime_error
+        , boost::format("\"%s\" is not an extended ROWID.") % sRowid
+    );
+    tRowid oRowid;
+    oRowid.iObj_ = iDecodeBase64(sRowid, 0, 6);
+    oRowid.iFile_ = iDecodeBase64(sRowid, 6, 3);
+    oRowid.iBlock_ = iDecodeBase64(sRowid, 9, 6);
+    oRowid.iRow_ = iDecodeBase64(sRowid, 15, 3);
+    return oRowid;
+}
+
+std::string cRowidSplitter::tRowid::sEncode() const
+{
+    std::string sRowid;
+    sRowid.reserve(18);
+    vEncodeBase64(sRowid, iObj_, 6);
+    vEncodeBase64(sRowid, iFile_, 3);
+    vEncodeBase64(sRowid, iBlock_, 6);
+    vEncodeBase64(sRowid, iRow_, 3);
+    return sRowid;
+}
+
+cRowidSplitter::cRowidSplitter(
+    const std::string& sTable
+    , const int32_t& iNumLanes
+    , const int32_t& iMinBlocks
+)
+    : trc_(ps::lib::cTracer::get_mutable_instance())
+    , sTable_(sTable)
+    , iNumLanes_(std::max(iNumLanes, 1))
+    , iMinBlocks_(std::max(iMinBlocks, 1))
+    , iRestBlocks_(0)
+    , iNumTaken_(0)
+    , iSmallest_(0)
+{}
+
+cRowidSplitter::~cRowidSplitter()
+{
+    trc_ << boost::format("%s; %d rowid range(s) were taken, the smallest one had %d block(s).")
+        % sTable_ % iNumTaken_ % iSmallest_
+        << std::endl;
+}
+
+void cRowidSplitter::vAddRange(const std::string& sBgn, const std::string& sEnd)
+{
+    const tRange oRange = {tRowid::oDecode(sBgn), tRowid::oDecode(sEnd)};
+    std::lock_guard<std::mutex> lk(mtx_);
+    oRanges_.push_back(oRange);
+    iRestBlocks_ += oRange.iNumBlocks();
+}
+
+bool cRowidSplitter::iTake(std::string& sql)
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (oRanges_.empty())
+    {
+        return false;
+    }
+    auto& oFront = oRanges_.front();
+    const auto iNumBlocks = oFront.iNumBlocks();
+    const auto iChunk = std::max(iMinBlocks_, iRestBlocks_ / (2 * iNumLanes_));
+    tRange oTaken = oFront;
+    // The rest must not be smaller than the minimum either.
+    if (iNumBlocks < iChunk + iMinBlocks_)
+    {
+        oRanges_.pop_front();
+    }
+    else
+    {
+        oTaken.oEnd_ = oFront.oEnd_;
+        oTaken.oEnd_.iBlock_ = oFront.oBgn_.iBlock_ + static_cast<uint32_t>(iChunk) - 1;
+        oFront.oBgn_.iBlock_ = oTaken.oEnd_.iBlock_ + 1;
+    }
+    const auto iTaken = oTaken.iNumBlocks();
+    iRestBlocks_ -= iTaken;
+    if (iTaken && (iSmallest_ == 0 || iTaken < iSmallest_))
+    {
+        iSmallest_ = iTaken;
+    }
+    ++iNumTaken_;
+    sql = (boost::format(szQuery)
+        % sTable_ % oTaken.oBgn_.sEncode() % oTaken.oEnd_.sEncode()
+    ).str();
+    return true;
+}
+
+} // ps::lib::sql::occi
+
+} // ps::lib::sql
+
+} // ps::lib
+
+} // ps
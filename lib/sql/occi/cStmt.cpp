@@ -145,8 +145,15 @@ void cStmt::vAnalyzeDescribe()
     }
     if (oDefine_.size() == 0)
     {
+        iNumBufferSets_ = iDecideNumBufferSets();
+        if (iNumBufferSets_ > 1)
+        {
+            // The address of the buffer set is notified before each fetching.
+            oDefine_.vSetTiming(ps::lib::sql::occi::cDefine::tTiming::iOnce);
+        }
         for (auto& oAttr: oAttrs_)
         {
+            oAttr.vSetNumBufferSets(iNumBufferSets_);
             oAttr.vSetDataBuffer(oDefine_);
         }
     }
@@ -161,16 +168,37 @@ void cStmt::vAnalyzeDescribe()
     {
         trc_ << boost::format("%s; ") % tag_ << std::setprecision(3)
             << boost::format(
-                "Buffer size=%s Bytes, "
+                "Buffer size=%s Bytes x %d set(s), "
                 "Setting PrefetchMemorySize=%s Bytes, "
                 "PrefetchRowCount=%d rows")
             % ps::lib::sBinIntToIntStr(iAclualAllocateSize)
+            % iNumBufferSets_
             % ps::lib::sBinIntToIntStr(iTmpBufMemSize)
             % ps::lib::sIntToa(iBulkSize_)
             << std::endl;
     }
 }
 
+uint32_t cStmt::iDecideNumBufferSets() const
+{
+    const auto iDepth = conf_.as<int32_t>("fetch_pipeline_depth");
+    if (iDepth <= 1)
+    {
+        return 1;
+    }
+    for (const auto& oAttr: oAttrs_)
+    {
+        if (! oAttr.iCanRotateBuffers())
+        {
+            trc_ << boost::format("%s; Pipelined fetching is disabled by the column %s (%s).")
+                % tag_ % oAttr.sGetFieldName() % oAttr.sGetFieldType()
+                << std::endl;
+            return 1;
+        }
+    }
+    return iDepth;
+}
+
 cStmt::cStmt(
     ps::lib::sql::occi::cSvc& oSvc
     , const uint32_t& iBulkSize
@@ -193,6 +221,7 @@ cStmt::cStmt(
     , stmt_(nullptr, ps::lib::sql::occi::cStmtDeleter(conn_))
     , rs_(nullptr, ps::lib::sql::occi::cRsDeleter(stmt_))
     , iFeedBack_(conf_.as<int32_t>("feedback"))
+    , iNumBufferSets_(1)
     , iFetchHasDone_(false)
 {
     BOOST_ASSERT(iBulkSize_);
@@ -222,6 +251,130 @@ void cStmt::vExecute()
     vAnalyzeDescribe();
 }
 
+/**
+ * @details
+ * - The converting thread is the only one that calls fetchable's
+ *   callbacks. Therefore cFetchable::vPreBulkAction is called
+ *   immediately before cFetchable::vPostBulkAction, not before fetching.
+ * - The current thread converts, so that the callbacks are called by
+ *   the same thread as iFetch was called.
+ * - Both threads hand over the index of the buffer set each other
+ *   through two queues. One is for the free sets and the other
+ *   is for the sets filled up with rows.
+ */
+uint32_t cStmt::iFetchPipelined(ps::lib::sql::cFetchable& fetchable)
+{
+    struct tBatch
+    {
+        uint32_t iSet_;
+        ub4 iNumIter_;
+    };
+    std::mutex mtx; // to protect following five variables.
+    std::condition_variable evt;
+    std::stack<uint32_t> oFreeSets;
+    std::deque<tBatch> oFilledSets;
+    bool iEndOfFetch = false;
+    bool iEndOfConv = false;
+    std::exception_ptr epFetch = nullptr;
+    for (auto iSet = iNumBufferSets_; iSet > 0; --iSet)
+    {
+        oFreeSets.push(iSet - 1);
+    }
+    std::thread oFetcher([&]()
+    {
+        try
+        {
+            sword iOciRtn = OCI_SUCCESS;
+            while (rtn_.iCotinue() && iOciRtn != OCI_NO_DATA)
+            {
+                uint32_t iSet = 0;
+                {
+                    std::unique_lock<std::mutex> lk(mtx);
+                    evt.wait(lk, [&]{ return ! oFreeSets.empty() || iEndOfConv; });
+                    if (iEndOfConv) break;
+                    iSet = oFreeSets.top();
+                    oFreeSets.pop();
+                }
+                for (const auto& oAttr: oAttrs_)
+                {
+                    oAttr.vChangeDataBuffer(oDefine_, iSet);
+                }
+                oDefine_.vAttachTo(oOciStmt_); // attaches host memory to SQL statement.
+                iOciRtn = iStmtFetch2(oOciStmt_, iBulkSize_, sql_);
+                const auto iNumIter = getNumArrayRows(oOciStmt_);
+                {
+                    std::lock_guard<std::mutex> lk(mtx);
+                    if (0 == iNumIter)
+                    {
+                        oFreeSets.push(iSet);
+                    }
+                    else
+                    {
+                        oFilledSets.push_back({iSet, iNumIter});
+                    }
+                }
+                evt.notify_all();
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lk(mtx);
+            epFetch = std::current_exception();
+        }
+        {
+            std::lock_guard<std::mutex> lk(mtx);
+            iEndOfFetch = true;
+        }
+        evt.notify_all();
+    });
+    auto iTotalRows = 0LU;
+    {
+        BOOST_SCOPE_EXIT(&mtx, &evt, &iEndOfConv, &oFetcher)
+        {
+            {
+                std::lock_guard<std::mutex> lk(mtx);
+                iEndOfConv = true;
+            }
+            evt.notify_all();
+            oFetcher.join();
+        } BOOST_SCOPE_EXIT_END
+        ub4 iNextFeedback = (iFeedBack_ * iBulkSize_);
+        for (;;)
+        {
+            tBatch oBatch;
+            {
+                std::unique_lock<std::mutex> lk(mtx);
+                evt.wait(lk, [&]{ return ! oFilledSets.empty() || iEndOfFetch; });
+                if (oFilledSets.empty()) break; // All rows already fetched are converted.
+                oBatch = oFilledSets.front();
+                oFilledSets.pop_front();
+            }
+            for (auto& oAttr: oAttrs_)
+            {
+                oAttr.vSelectBufferSet(oBatch.iSet_);
+            }
+            fetchable.vPreBulkAction(iBulkSize_);
+            fetchable.vPostBulkAction(oBatch.iNumIter_);
+            iTotalRows += oBatch.iNumIter_;
+            if (iFeedBack_ > 0 && iTotalRows >= iNextFeedback)
+            {
+                fetchable.vFeedbackAction();
+                iNextFeedback = iFeedBack_ * iBulkSize_ + iTotalRows;
+            }
+            {
+                std::lock_guard<std::mutex> lk(mtx);
+                oFreeSets.push(oBatch.iSet_);
+            }
+            evt.notify_all();
+        }
+    }
+    if (epFetch)
+    {
+        std::rethrow_exception(epFetch);
+    }
+    return iTotalRows;
+}
+
 /**
  * @details
  *
@@ -253,6 +406,12 @@ try
     auto iTotalRows = 0LU;
     BOOST_ASSERT(oOciStmt_.oGetOciSvcCtx());
     BOOST_ASSERT(oDefine_.size());
+    if (iNumBufferSets_ > 1)
+    {
+        iTotalRows = iFetchPipelined(fetchable);
+        iFetchHasDone_ = true;
+        return iTotalRows;
+    }
     if (oDefine_.iGetTiming() == ps::lib::sql::occi::cDefine::tTiming::iRepeat)
     {
         oDefine_.vAttachTo(oOciStmt_); // attaches host memory to SQL statement.
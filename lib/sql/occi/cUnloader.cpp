@@ -34,6 +34,43 @@ namespace occi
 {
 const int32_t cUnloader::NO_LONG_COLUMN = 0;
 
+/**
+ * @class cUnloader::cBulkHandler
+ * @brief
+ * Receives the bulks fetched by one element of @ref oCont_, which is bound
+ * when the task is submitted, so that the element is not looked up for each bulk.
+ * The other callbacks are forwarded to the unloader.
+ */
+class cUnloader::cBulkHandler
+    : public ps::lib::sql::cFetchable
+{
+public:
+    cBulkHandler(cUnloader& oOwner, tValue& oItem)
+        : oOwner_(oOwner)
+        , oItem_(oItem)
+    {}
+    void vExecuteAndFetch() { oOwner_.vExecuteAndFetch(); }
+    void vPreRepeatAction() { oOwner_.vPreRepeatAction(); }
+    void vPostRepeatAction() { oOwner_.vPostRepeatAction(); }
+    void vNotFoundAction() { oOwner_.vNotFoundAction(); }
+    void vPreBulkAction(const uint32_t&)
+    {
+        oOwner_.vClearBuffer(oItem_);
+    }
+    void vPostBulkAction(const uint32_t& iNumIter)
+    {
+        BOOST_ASSERT(oOwner_.iBulkSize_ >= iNumIter);
+        oOwner_.vSerializeRows(oItem_, iNumIter);
+        oOwner_.vPutRowsToDataFile(oItem_, iNumIter);
+        oOwner_.vAddOutputRows(iNumIter);
+    }
+    void vFeedbackAction() { oOwner_.vFeedbackAction(); }
+    void vFinalizeAction() { oOwner_.vFinalizeAction(); }
+private:
+    cUnloader& oOwner_;
+    tValue& oItem_;
+};
+
 /**
  * @details
  */
@@ -88,10 +125,14 @@ void cUnloader::vAddOutputRows(const int32_t& iOutputRows)
 void cUnloader::vShowStatValue() const
 {
     // counts the number of the element SQLs fetch has done.
-    const size_t iNumFetchHasDone = std::count_if(
-        oCont_.cbegin(), oCont_.cend()
-        , [](const tValue& oItem){ return oItem.oStmt_->iGetFetchHasDone(); }
-    );
+    size_t iNumFetchHasDone = 0;
+    {
+        std::lock_guard<spinlock_t> lk(spin_);
+        iNumFetchHasDone = std::count_if(
+            oCont_.cbegin(), oCont_.cend()
+            , [](const tValue& oItem){ return oItem.oStmt_->iGetFetchHasDone(); }
+        );
+    }
     const auto iMiSec = stat_.iDurationMilliSeconds();
     const auto iOutputBytes = stat_.iGetOutputBytes();
     const auto iDataRate = iMiSec ? iOutputBytes * 1000 / iMiSec : 0;
@@ -107,7 +148,7 @@ void cUnloader::vShowStatValue() const
         % ps::lib::sBinIntToIntStr(iOutputBytes)
         % (iMiSec/1000.0)
         % ps::lib::sBinIntToIntStr(iDataRate)
-        % sContinuety
+        % (sContinuety + stat_.sGetEta())
     << std::endl;
     // Detail of statistics for tracefile.
     trc_ << boost::format(ps::lib::sql::sFmtStatTrace)
@@ -124,18 +165,10 @@ void cUnloader::vShowStatValue() const
 /**
  * @details
  */
-void cUnloader::vClearBuffer()
+void cUnloader::vClearBuffer(tValue& oItem)
 {
-    BOOST_ASSERT(oCont_.size());
-    for (auto& oRowBuf : oCont_[*oTls_].oRowBuf_)
-    {
-        /*
-         * In order to avoid shrinking allocated storage,
-         * clearing of the buffer by the following method 
-         * is effective other than substitution empty a string.
-         */
-        oRowBuf.clear();
-    }
+    // The allocated storage is kept to be reused by the next bulk.
+    oItem.oSlab_->vClear();
 }
 /**
  * @details
@@ -149,37 +182,38 @@ void cUnloader::vPutColumnNamesToDataFile()
     vAddOutputBytes(buf.size());
     // column name list is not a part of row data.
     vAddOutputRows(ps::lib::iOneItem);
-    *st_data_ << buf;
-    ASSERT_OR_RAISE(*st_data_, std::runtime_error, ::strerror(errno));
+    ps::lib::cSlabWriter::tSlabPtr oSlab(new ps::lib::cSlab(buf.size()));
+    *oSlab += buf;
+    oWriter_->vPush(oSlab);
 }
 /**
  * @details
  */
-void cUnloader::vSetRowBuf(
-    const int32_t& iCol
-    , const uint32_t& iNumIter
-    , const bool& iSep
-){
+void cUnloader::vSerializeRows(tValue& oItem, const uint32_t& iNumIter)
+{
     BOOST_ASSERT(iNumIter);
-    auto& oRowBuf = oCont_[*oTls_].oRowBuf_; // Converted data is filled up here.
-    oCont_[*oTls_].oStmt_->oGetAttrs()[iCol].vConvertStringVct(oRowBuf, iNumIter, iSep, oDelim_);
+    BOOST_ASSERT(oItem.oPlan_);
+    try
+    {
+        oItem.oPlan_->vEncode(*oItem.oSlab_, iNumIter); // Converted data is filled up here.
+    }
+    catch (...)
+    {
+        // Other threads must not wait for the rest of a row spilled partially.
+        oWriter_->vRelease();
+        throw;
+    }
 }
 /**
  * @details
  */
-void cUnloader::vPutRowsToDataFile(const uint32_t& iNumIter)
+void cUnloader::vPutRowsToDataFile(tValue& oItem, const uint32_t& iNumIter)
 {
-    std::lock_guard<spinlock_t> lk(spin_);
-    auto& oRowBuf = oCont_[*oTls_].oRowBuf_;
-    for (auto iRow = 0u; iRow < iNumIter; ++iRow)
-    {
-        oRowBuf[iRow] += oDelim_.sGetLastSeparator(ps::lib::cDelimiter::iData);
-        oRowBuf[iRow] += oDelim_.sGetRowSeparator(ps::lib::cDelimiter::iData);
-        const auto& sLength = oDelim_.sGetLengthString(oRowBuf[iRow]);
-        vAddOutputBytes(sLength.size() + oRowBuf[iRow].size());
-        *st_data_ << sLength << oRowBuf[iRow];
-    }
-    ASSERT_OR_RAISE(*st_data_, std::runtime_error, ::strerror(errno));
+    auto& oSlab = oItem.oSlab_;
+    vAddOutputBytes(oSlab->size());
+    // The filled slab is handed over to the writer thread,
+    // and an empty one is returned to be used by the next bulk.
+    oWriter_->vPush(oSlab);
 }
 /**
  * @details
@@ -187,16 +221,113 @@ void cUnloader::vPutRowsToDataFile(const uint32_t& iNumIter)
 void cUnloader::vPutGrammerToCtrlFile()
 {
     BOOST_ASSERT(sLastOpendFilenme_.has_filename());
+    // A delta holds only the rows changed, so the table must never be truncated by it.
+    const bool iDelta = iIncremental_ && iSinceScn_;
+    if (iPieceBytes_ == 0)
+    {
+        const auto sCtrlDir = sOpenCtrlFile();
+        ps::lib::sql::cCtrlFile oCtrlFile(
+            sGetInfile(sLastOpendFilenme_, sCtrlDir), tag_, sPartitionName_, iNumLongs_
+        );
+        if (iDelta)
+        {
+            oCtrlFile.vSetAppend();
+        }
+        vWriteCtrlFile(oCtrlFile);
+        return;
+    }
+    // Each piece can be loaded by itself, in parallel with the others.
+    for (size_t i = 0; i < oPieces_.size(); ++i)
+    {
+        oStreamSup_->vSetPiece(static_cast<int32_t>(i) + 1);
+        const auto sCtrlDir = sOpenCtrlFile();
+        ps::lib::sql::cCtrlFile oCtrlFile(
+            sGetInfile(oPieces_[i], sCtrlDir), tag_, sPartitionName_, iNumLongs_
+        );
+        oCtrlFile.vSetAppend();
+        vWriteCtrlFile(oCtrlFile);
+    }
+    // The control file without the piece number, which _make.sh refers to, loads all of them.
+    oStreamSup_->vSetPiece(0);
+    const auto sCtrlDir = sOpenCtrlFile();
     ps::lib::sql::cCtrlFile oCtrlFile(
-        sLastOpendFilenme_.filename(), tag_, sPartitionName_, iNumLongs_
+        sGetInfile(oPieces_.front(), sCtrlDir), tag_, sPartitionName_, iNumLongs_
     );
+    for (size_t i = 1; i < oPieces_.size(); ++i)
+    {
+        oCtrlFile.vAddInfile(sGetInfile(oPieces_[i], sCtrlDir));
+    }
+    if (iDelta)
+    {
+        oCtrlFile.vSetAppend();
+    }
+    vWriteCtrlFile(oCtrlFile);
+}
+/**
+ * @details
+ */
+std::string cUnloader::sGetPieces() const
+{
+    std::vector<std::string> oFiles;
+    for (const auto& sPiece: oPieces_)
+    {
+        oFiles.push_back(sPiece.string());
+    }
+    return boost::algorithm::join(oFiles, std::string(ps::lib::cManifest::szPieceSep));
+}
+/**
+ * @details
+ */
+boost::filesystem::path cUnloader::sOpenCtrlFile()
+{
     st_ctrl_ = oStreamSup_->oOpen(ps::lib::nsStreamLocator::iExtCtrl, sDataFileDir_);
+    return oStreamSup_->oGetsLastOpendFilename().parent_path();
+}
+/**
+ * @details
+ * _make.sh runs SQL*Loader in the directory of the control file,
+ * and SQL*Loader resolves a relative INFILE from its current directory.
+ */
+boost::filesystem::path cUnloader::sGetInfile(
+    const boost::filesystem::path& sPiece
+    , const boost::filesystem::path& sCtrlDir
+) const
+{
+    const auto sPieceAbs = boost::filesystem::absolute(sPiece);
+    return sPieceAbs.parent_path() == boost::filesystem::absolute(sCtrlDir)
+        ? sPiece.filename()
+        : sPieceAbs;
+}
+/**
+ * @details
+ */
+void cUnloader::vWriteCtrlFile(const ps::lib::sql::cCtrlFile& oCtrlFile)
+{
     BOOST_SCOPE_EXIT(&st_ctrl_,&oStreamSup_)
     {
         st_ctrl_->flush();
         delete st_ctrl_.release();
     }
     BOOST_SCOPE_EXIT_END;
+    const auto iScn = ps::lib::cManifest::get_mutable_instance().iGetScn();
+    if (iScn && iIncremental_)
+    {
+        *st_ctrl_ << boost::format("-- Unloaded the current rows, the next delta starts after SCN %d\n") % iScn;
+    }
+    else if (iScn)
+    {
+        *st_ctrl_ << boost::format("-- Unloaded AS OF SCN %d\n") % iScn;
+    }
+    if (iIncremental_ && iSinceScn_)
+    {
+        *st_ctrl_ << boost::format(
+            "-- Delta of %s/%s: rows in the blocks changed after SCN %d.\n"
+            "-- ORA_ROWSCN is tracked per block unless the table has ROWDEPENDENCIES,\n"
+            "-- so that unchanged rows sharing a block with a changed one are included too.\n"
+            "-- They are appended. Rows updated must be merged, e.g. through a staging table,\n"
+            "-- and rows deleted are not included.\n")
+            % tag_ % sPartitionName_ % iSinceScn_;
+    }
     *st_ctrl_ << oCtrlFile.sGetGrammar() << sGetFieldsListForCtrl()
       << std::flush;
     ASSERT_OR_RAISE(*st_ctrl_, std::runtime_error, ::strerror(errno));
@@ -220,13 +351,17 @@ cUnloader::cUnloader(
     , cout_(ps::lib::cConsole::get_mutable_instance())
     , trc_(ps::lib::cTracer::get_mutable_instance())
     , mos_(ps::lib::cDistributor::get_mutable_instance())
+    , oSvc_(oSvc)
     , spin_(std::chrono::microseconds(300)) // microseconds to wait for each spin.
-    , iTls_(0)
-    , oTls_(vRegularDeleter<int32_t>)
     , iTotalBytes_(0)
     , iTotalRows_(0U)
+    , iEstimatedBytes_(0)
     , tag_(tag)
     , iNumLongs_(iNumLongs)
+    // The statements of a user query, which are given with a bind, are always unloaded in full.
+    , iIncremental_(oBind == nullptr && conf_.as<bool>("incremental"))
+    , iSinceScn_(0)
+    , iPieceBytes_(ps::lib::iIntStrToBinInt<int64_t>(conf_.as<std::string>("filesize")))
     , oDelim_(ps::lib::oMakeVarDelimiter())
     , iBulkSize_(iBulkSize)
     , oStreamSup_(oStreamSup)
@@ -244,7 +379,9 @@ cUnloader::cUnloader(
         const auto trimed = boost::trim_copy(sql);
         if (ps::lib::trim(trimed).size() == 0U) return;
         oCont_.emplace_back(
-            new ps::lib::sql::occi::cStmt(oSvc, iBulkSize_, trimed, tag_, oBind)
+            iIncremental_
+            ? new ps::lib::sql::occi::cStmt(oSvc, iBulkSize_, sRestrictToChanges(trimed), tag_, &oDeltaBind_)
+            : new ps::lib::sql::occi::cStmt(oSvc, iBulkSize_, trimed, tag_, oBind)
             , iBulkSize_
         );
     }
@@ -274,21 +411,104 @@ void cUnloader::vExecuteAndFetch()
 {
     auto iTotal = 0lu;
     std::exception_ptr ep = nullptr;
+    auto& oManifest(ps::lib::cManifest::get_mutable_instance());
+    const auto sKey = tag_ + "/" + oStreamSup_->sGetPartitionName();
+    {
+        ps::lib::cManifest::tEntry oDone;
+        if (oManifest.iIsCompleted(sKey, oDone))
+        {
+            trc_ << boost::format("Rerunpoint: %s was skipped, %s rows had been unloaded into %s.")
+                % sKey % ps::lib::sIntToa(oDone.iNumRows_) % oDone.sFile_ << std::endl;
+            // The rest of the run is estimated without this task.
+            stat_.vAddEstimatedBytes(-iEstimatedBytes_);
+            return;
+        }
+    }
+    if (iIncremental_)
+    {
+        // Bound here, because the baseline is known only after the task is identified.
+        iSinceScn_ = oManifest.iGetBaseScn(sKey);
+        oDeltaBind_.vAddItem(":b_last_scn", &iSinceScn_);
+        trc_ << boost::format("Incremental: %s is unloaded %s.") % sKey
+            % (iSinceScn_ ? (boost::format("since SCN %d") % iSinceScn_).str() : std::string("in full"))
+            << std::endl;
+        if (iSinceScn_)
+        {
+            // The data files of the delta carry both SCNs, and the manifest records them.
+            oStreamSup_->vSetDelta(
+                (boost::format("_scn%d-%d") % iSinceScn_ % oManifest.iGetScn()).str()
+            );
+        }
+    }
+    if (iPieceBytes_ > 0)
+    {
+        oStreamSup_->vSetPiece(1);
+    }
+    // The estimate from the segment is used to preallocate the data file.
+    oStreamSup_->vSetExpectedBytes(
+        iPieceBytes_ > 0 ? std::min(iPieceBytes_, iEstimatedBytes_) : iEstimatedBytes_
+    );
     st_data_ = oStreamSup_->oOpen(ps::lib::nsStreamLocator::iExtData, sDataFileDir_);
     sLastOpendFilenme_ = oStreamSup_->oGetsLastOpendFilename();
+    oPieces_.assign(1, sLastOpendFilenme_);
     sPartitionName_ = oStreamSup_->sGetPartitionName();
+    oManifest.vStart(sKey, sLastOpendFilenme_.string());
+    ps::lib::cManifest::tEntry oEntry = {
+        true, sLastOpendFilenme_.string(), 0, 0, 0U, oManifest.iGetScn(), 0
+    };
     {
-        BOOST_SCOPE_EXIT(&st_data_)
+        BOOST_SCOPE_EXIT(&st_data_, &oWriter_, &oPieces_)
         {
+            // The writer thread must be stopped before the stream is closed.
+            oWriter_.reset();
             // flush() operation can not be omitted.
             // Because the end of the data is lost.
-            st_data_->flush();
-            delete st_data_.release();
+            if (st_data_)
+            {
+                st_data_->flush();
+                delete st_data_.release();
+                ps::lib::nsStreamLocator::cPlacement::get_mutable_instance().vRelease(oPieces_.back());
+            }
         }
         BOOST_SCOPE_EXIT_END;
+        oWriter_.reset(new ps::lib::cSlabWriter(
+            *st_data_, conf_.as<int32_t>("write_queue_depth"), tag_
+        ));
+        if (ps::lib::nsStreamLocator::cPlacement::get_const_instance().iEnabled())
+        {
+            // Called by the writer thread, which is also the one rolling oPieces_ over.
+            oWriter_->vSetMeter([this](const int64_t& iBytes, const int64_t& iMicroSecs) {
+                ps::lib::nsStreamLocator::cPlacement::get_mutable_instance()
+                    .vAddWritten(oPieces_.back(), iBytes, iMicroSecs);
+            });
+        }
+        if (iPieceBytes_ > 0)
+        {
+            // Called by the writer thread, which is the only one using st_data_ while fetching.
+            oWriter_->vSetRolling(iPieceBytes_, [this, &oManifest, sKey]() -> std::ostream& {
+                st_data_->flush();
+                ASSERT_OR_RAISE(*st_data_, std::runtime_error, ::strerror(errno));
+                oStreamSup_->vSetPiece(static_cast<int32_t>(oPieces_.size()) + 1);
+                // The previous piece is kept in st_data_ until the next one is opened,
+                // so that the scope exit closes it if the open fails.
+                auto oNext = oStreamSup_->oOpen(ps::lib::nsStreamLocator::iExtData, sDataFileDir_);
+                st_data_.swap(oNext);
+                delete oNext.release();
+                // The next piece may be placed in another directory.
+                ps::lib::nsStreamLocator::cPlacement::get_mutable_instance().vRelease(oPieces_.back());
+                oPieces_.push_back(oStreamSup_->oGetsLastOpendFilename());
+                trc_ << boost::format("%s; Rolled over to %s.") % tag_ % oPieces_.back() << std::endl;
+                // The pieces of a partial task are deleted when restarted.
+                oManifest.vStart(sKey, sGetPieces());
+                return *st_data_;
+            });
+        }
+        // Declared after the writer, so that it waits for the tasks before the writer is stopped.
+        ps::lib::cScheduler::cGroup oGroup;
         for (auto& oItem: oCont_)
         {
             oItem.oStmt_->vExecute();
+            vSetUpPlan(oItem);
             if (&oCont_[0] == &oItem)
             {
                 /*
@@ -304,30 +524,45 @@ void cUnloader::vExecuteAndFetch()
                  * to check for whether data type of the fields of
                  * the first statement are compatible with type of
                  * the fields of the other statement.
+                 * The first statement may be replaced by the next rowid range.
                  */
+                std::lock_guard<spinlock_t> lk(spin_);
                 ps::lib::sql::occi::vCheckCompatibility(
                     oCont_[0].oStmt_->oGetAttrs()
                     , oItem.oStmt_->oGetAttrs()
                 );
             }
             if (!rtn_.iCotinue()) break;
-            std::packaged_task<uint32_t()> task(std::bind(
-                &ps::lib::sql::occi::cStmt::iFetch
-                , oItem.oStmt_.get()
-                , std::ref(*this), std::ref(ep)
-            ));
-            oItem.oFuture_ = task.get_future();
-            oItem.oThr_.reset(new std::thread(std::move(task)));
-            oItem.iTid_ = oItem.oThr_->get_id();
+            ps::lib::cScheduler::get_mutable_instance().vSubmit(oGroup
+                , [this, &oItem, &ep]{
+                    oItem.iTid_ = std::this_thread::get_id();
+                    std::exception_ptr epItem = nullptr;
+                    oItem.iNumRows_ = iFetchAll(oItem, epItem);
+                    if (epItem)
+                    {
+                        std::lock_guard<spinlock_t> lk(spin_);
+                        if (ep == nullptr)
+                        {
+                            ep = epItem;
+                        }
+                    }
+                }
+            );
         }
-        for (auto& oItem: oCont_)
+        oGroup.vWait();
+        for (const auto& oItem: oCont_)
         {
-            if (oItem.oThr_ && oItem.oThr_->joinable())
-            {
-                oItem.oThr_->join();
-                iTotal += (oItem.iNumRows_ = oItem.oFuture_.get());
-            }
+            iTotal += oItem.iNumRows_;
         }
+        // Waits for the queued bulks to be written, and reports the statistics.
+        oWriter_->vClose();
+        // The file is not done unless the writes queued by the stream itself have succeeded.
+        st_data_->flush();
+        ASSERT_OR_RAISE(*st_data_, std::runtime_error
+            , boost::format("Failed to write %s.") % oPieces_.back());
+        stat_.vSettleEstimate(iEstimatedBytes_, iTotalBytes_.load());
+        oEntry.iNumBytes_ = oWriter_->iGetBytesWritten();
+        oEntry.iCrc32_ = oWriter_->iGetChecksum();
         if (iTotal)
         {
             vPostRepeatAction();
@@ -342,6 +577,14 @@ void cUnloader::vExecuteAndFetch()
     {
         vPutGrammerToCtrlFile();
     }
+    // The task is complete when the control file is written as well,
+    // and not if any statement failed or the run was cancelled.
+    if (ep == nullptr && rtn_.iCotinue())
+    {
+        oEntry.sFile_ = sGetPieces();
+        oEntry.iNumRows_ = iTotal;
+        oManifest.vFinish(sKey, oEntry);
+    }
     {
         for (const auto& oItem: oCont_)
         {
@@ -357,6 +600,15 @@ void cUnloader::vExecuteAndFetch()
         }
         trc_ << boost::format("    Data total=%16s [%s]")
             % ps::lib::sIntToa(iTotal) % tag_ << std::endl;
+        if (oCont_.size() > 1 && iTotal)
+        {
+            // The ratio of the largest statement to the average, 1.00 means even.
+            const auto it = std::max_element(oCont_.cbegin(), oCont_.cend()
+                , [](const tValue& lhs, const tValue& rhs) { return lhs.iNumRows_ < rhs.iNumRows_; }
+            );
+            trc_ << boost::format("          Skew=%16.2f [%s]")
+                % (static_cast<double>(it->iNumRows_) * oCont_.size() / iTotal) % tag_ << std::endl;
+        }
     }
     if (ep)
     {
@@ -378,28 +630,94 @@ void cUnloader::vPreRepeatAction()
  */
 void cUnloader::vPreBulkAction(const uint32_t& iBulkSize)
 {
-    std::lock_guard<spinlock_t> lk(spin_);
+    BOOST_ASSERT(oCont_.size() == 1);
+    vClearBuffer(oCont_[0]);
+}
+/**
+ * @details
+ */
+void cUnloader::vSetUpPlan(tValue& oItem)
+{
+    oItem.oPlan_.reset(new ps::lib::sql::occi::cEncoderPlan(
+        oItem.oStmt_->oGetAttrs(), oDelim_, tag_
+    ));
+    // Streamed LOB values are handed over to the writer piece by piece.
+    oItem.oPlan_->vSetSpill([this](ps::lib::cSlab& oSlab) {
+        vAddOutputBytes(oSlab.size());
+        oWriter_->vSpill(oSlab);
+    });
+}
+/**
+ * @details
+ * - The statement of the next range is executed and described
+ *   before it replaces tValue::oStmt_, so that the previous one
+ *   is disconnected only after the next one was ready.
+ * - The columns are not checked for compatibility, because
+ *   all ranges belong to the same table.
+ */
+uint32_t cUnloader::iFetchAll(tValue& oItem, std::exception_ptr& ep)
+{
+    cBulkHandler oHandler(*this, oItem);
+    auto iNumRows = oItem.oStmt_->iFetch(oHandler, ep);
+    std::string sql;
+    while (oSplitter_ && ep == nullptr && rtn_.iCotinue() && oSplitter_->iTake(sql))
     {
-        if (!oTls_.get())
+        std::unique_ptr<ps::lib::sql::occi::cStmt> oStmt;
+        try
+        {
+            oStmt.reset(iIncremental_
+                ? new ps::lib::sql::occi::cStmt(oSvc_, iBulkSize_, sRestrictToChanges(sql), tag_, &oDeltaBind_)
+                : new ps::lib::sql::occi::cStmt(oSvc_, iBulkSize_, sql, tag_, nullptr)
+            );
+            oStmt->vExecute();
+        }
+        catch (...)
         {
-            // TLS has not been allocated.
-            oTls_.reset(new int32_t(iTls_++));
+            ep = std::current_exception();
+            break;
         }
+        {
+            std::lock_guard<spinlock_t> lk(spin_);
+            oItem.oStmt_.swap(oStmt);
+        }
+        vSetUpPlan(oItem);
+        iNumRows += oItem.oStmt_->iFetch(oHandler, ep);
     }
-    vClearBuffer();
+    return iNumRows;
 }
 /**
  * @details
+ * The condition which already exists is enclosed in parentheses,
+ * so that the predicate is applied to all of it.
  */
-void cUnloader::vPostBulkAction(const uint32_t& iNumIter) 
+std::string cUnloader::sRestrictToChanges(const std::string& sql) const
 {
-    BOOST_ASSERT(iBulkSize_ >= iNumIter);
-    const auto iNumCols = iGetNumCols();
-    for (auto i = 0; i < iNumCols; ++i)
+    static const std::string sWhere(" WHERE ");
+    static const std::string sPredicate("ORA_ROWSCN > :b_last_scn");
+    const auto pos = sql.find(sWhere);
+    if (pos == std::string::npos)
     {
-        vSetRowBuf(i, iNumIter, i < iNumCols - 1);
+        return sql + sWhere + sPredicate;
     }
-    vPutRowsToDataFile(iNumIter);
+    return sql.substr(0, pos + sWhere.size())
+        + sPredicate + " AND (" + sql.substr(pos + sWhere.size()) + ")";
+}
+/**
+ * @details
+ */
+void cUnloader::vSetRowidSplitter(ps::lib::sql::occi::cRowidSplitter* oSplitter)
+{
+    oSplitter_.reset(oSplitter);
+}
+/**
+ * @details
+ */
+void cUnloader::vPostBulkAction(const uint32_t& iNumIter) 
+{
+    BOOST_ASSERT(oCont_.size() == 1);
+    BOOST_ASSERT(iBulkSize_ >= iNumIter);
+    vSerializeRows(oCont_[0], iNumIter);
+    vPutRowsToDataFile(oCont_[0], iNumIter);
     vAddOutputRows(iNumIter);
 }
 /**
@@ -439,6 +757,21 @@ void cUnloader::vFinalizeAction()
 {
     vShowStatValue(); // Final report.
 }
+/**
+ * @details
+ */
+void cUnloader::vSetEstimatedBytes(const int64_t& iEstimatedBytes)
+{
+    iEstimatedBytes_ = std::max<int64_t>(iEstimatedBytes, 0);
+    stat_.vAddEstimatedBytes(iEstimatedBytes_);
+}
+/**
+ * @details
+ */
+int64_t cUnloader::iGetEstimatedBytes() const
+{
+    return iEstimatedBytes_;
+}
 
 } // ps::lib::sql::occi
 
@@ -86,6 +86,59 @@ void vLobFileGetName(
     }
 }
 
+oraub8 iLobGetLength(
+    cOciStmt& oOciStmt
+    , OCILobLocator *locp
+){
+    cOciErr& oOciErr = oOciStmt.oGetOciErr();
+    oraub8 iLength = 0;
+    sword iOciRtn = OCILobGetLength2(
+        oOciStmt.oGetOciSvcCtx(), oOciErr.oGetErrhp(), locp, &iLength
+    );
+    PS_OCI_ASSERT(iOciRtn == oracle::occi::OCCI_SUCCESS, oOciErr, iOciRtn);
+    return iLength;
+}
+
+bool iLobRead(
+    cOciStmt& oOciStmt
+    , OCILobLocator *locp
+    , const ub1& csfrm
+    , char *buf
+    , const oraub8& bufl
+    , const ub1& piece
+    , oraub8& iRead
+){
+    cOciErr& oOciErr = oOciStmt.oGetOciErr();
+    // Zero for both amounts reads the whole LOB in the polling mode.
+    oraub8 iByteAmt = 0;
+    oraub8 iCharAmt = 0;
+    sword iOciRtn = OCILobRead2(
+        oOciStmt.oGetOciSvcCtx(), oOciErr.oGetErrhp(), locp
+        , &iByteAmt, &iCharAmt, 1 /*offset*/
+        , buf, bufl, piece
+        , NULL /*ctxp*/, NULL /*cbfp*/, 0 /*csid*/, csfrm
+    );
+    PS_OCI_ASSERT(
+        iOciRtn == oracle::occi::OCCI_SUCCESS || iOciRtn == OCI_NEED_DATA
+        , oOciErr, iOciRtn
+    );
+    iRead = iByteAmt;
+    return iOciRtn == OCI_NEED_DATA;
+}
+
+ub4 iNlsMaxByteSize(
+    cOciErr& oOciErr
+    , const ub1& csfrm
+){
+    sb4 iValue = 0;
+    sword iOciRtn = OCINlsNumericInfoGet(
+        oOciErr.oGetEnvhp(), oOciErr.oGetErrhp(), &iValue
+        , csfrm == SQLCS_NCHAR ? OCI_NLS_NCHARSET_MAXBYTESZ : OCI_NLS_CHARSET_MAXBYTESZ
+    );
+    PS_OCI_ASSERT(iOciRtn == oracle::occi::OCCI_SUCCESS, oOciErr, iOciRtn);
+    return static_cast<ub4>(iValue);
+}
+
 void vNumberToText(
     cOciErr& oOciErr
     , const OCINumber *val
@@ -100,6 +153,33 @@ void vNumberToText(
     PS_OCI_ASSERT(iOciRtn == oracle::occi::OCCI_SUCCESS, oOciErr, iOciRtn);
 }
 
+void vDateTimeGetDateTime(
+    cOciErr& oOciErr
+    , OCIDateTime *val
+    , sb2 *yr, ub1 *mnth, ub1 *dy
+    , ub1 *hr, ub1 *mm, ub1 *ss, ub4 *fsec
+){
+    sword iOciRtn = OCIDateTimeGetDate(
+        oOciErr.oGetEnvhp(), oOciErr.oGetErrhp(), val, yr, mnth, dy
+    );
+    PS_OCI_ASSERT(iOciRtn == oracle::occi::OCCI_SUCCESS, oOciErr, iOciRtn);
+    iOciRtn = OCIDateTimeGetTime(
+        oOciErr.oGetEnvhp(), oOciErr.oGetErrhp(), val, hr, mm, ss, fsec
+    );
+    PS_OCI_ASSERT(iOciRtn == oracle::occi::OCCI_SUCCESS, oOciErr, iOciRtn);
+}
+
+void vDateTimeGetTimeZoneOffset(
+    cOciErr& oOciErr
+    , const OCIDateTime *val
+    , sb1 *hr, sb1 *mm
+){
+    sword iOciRtn = OCIDateTimeGetTimeZoneOffset(
+        oOciErr.oGetEnvhp(), oOciErr.oGetErrhp(), val, hr, mm
+    );
+    PS_OCI_ASSERT(iOciRtn == oracle::occi::OCCI_SUCCESS, oOciErr, iOciRtn);
+}
+
 void vDefineArrayOfStruct(
     cOciStmt& oOciStmt
     , int32_t pos
@@ -0,0 +1,211 @@
+#include <pslib.h>
+
+namespace ps
+{
+namespace lib
+{
+namespace test
+{
+
+namespace sl = ps::lib::nsStreamLocator;
+
+/**
+ * @brief
+ *   Rows like a data file, followed by bytes hard to compress.
+ */
+std::string sMakeSyntheticData(const size_t& iNumRows)
+{
+    std::mt19937 oRand(20231017);
+    std::ostringstream oss;
+    for (size_t i = 0; i < iNumRows; ++i)
+    {
+        oss << i << ",\"NAME" << (i % 997) << "\"," << oRand() << ",2023-10-17 12:34:56\n";
+    }
+    for (size_t i = 0; i < iNumRows; ++i)
+    {
+        oss.put(static_cast<char>(oRand()));
+    }
+    return oss.str();
+}
+
+std::string sReadFile(const boost::filesystem::path& sPath)
+{
+    boost::filesystem::ifstream ifs(sPath, std::ios_base::in | std::ios_base::binary);
+    return std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+}
+
+/// @brief Inflates all gzip members concatenated. At least one member is required.
+std::string sDecompressGzip(const std::string& sIn)
+{
+    std::string sOut;
+    size_t iPos = 0;
+    do
+    {
+        z_stream zs;
+        std::memset(&zs, 0, sizeof(zs));
+        ASSERT_OR_RAISE(Z_OK == ::inflateInit2(&zs, 15 + 16), std::runtime_error, "inflateInit2");
+        zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(sIn.data() + iPos));
+        zs.avail_in = static_cast<uInt>(sIn.size() - iPos);
+        int rc = Z_OK;
+        while (rc != Z_STREAM_END)
+        {
+            char buf[65536];
+            zs.next_out = reinterpret_cast<Bytef*>(buf);
+            zs.avail_out = sizeof(buf);
+            rc = ::inflate(&zs, Z_NO_FLUSH);
+            ASSERT_OR_RAISE(rc == Z_OK || rc == Z_STREAM_END, std::runtime_error
+                , boost::format("inflate rc=%d") % rc);
+            sOut.append(buf, sizeof(buf) - zs.avail_out);
+        }
+        iPos += zs.total_in;
+        ::inflateEnd(&zs);
+    } while (iPos < sIn.size());
+    return sOut;
+}
+
+#ifdef PS_HAVE_ZSTD
+/// @brief At least one complete frame is required.
+std::string sDecompressZstd(const std::string& sIn)
+{
+    std::string sOut;
+    auto zds = ::ZSTD_createDStream();
+    ::ZSTD_initDStream(zds);
+    std::vector<char> buf(::ZSTD_DStreamOutSize());
+    ZSTD_inBuffer oIn = {sIn.data(), sIn.size(), 0};
+    size_t rc = 1;
+    while (oIn.pos < oIn.size)
+    {
+        ZSTD_outBuffer oOut = {buf.data(), buf.size(), 0};
+        rc = ::ZSTD_decompressStream(zds, &oOut, &oIn);
+        ASSERT_OR_RAISE(! ::ZSTD_isError(rc), std::runtime_error, ::ZSTD_getErrorName(rc));
+        sOut.append(buf.data(), oOut.pos);
+    }
+    ::ZSTD_freeDStream(zds);
+    ASSERT_OR_RAISE(rc == 0, std::runtime_error, "zstd frame is incomplete.");
+    return sOut;
+}
+#endif
+
+#ifdef PS_HAVE_LZ4
+/// @brief At least one complete frame is required.
+std::string sDecompressLz4(const std::string& sIn)
+{
+    std::string sOut;
+    LZ4F_dctx* dctx = nullptr;
+    ASSERT_OR_RAISE(! ::LZ4F_isError(::LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION))
+        , std::runtime_error, "LZ4F_createDecompressionContext");
+    size_t iPos = 0;
+    size_t rc = 1;
+    while (iPos < sIn.size())
+    {
+        char buf[65536];
+        size_t iOut = sizeof(buf), iIn = sIn.size() - iPos;
+        rc = ::LZ4F_decompress(dctx, buf, &iOut, sIn.data() + iPos, &iIn, nullptr);
+        ASSERT_OR_RAISE(! ::LZ4F_isError(rc), std::runtime_error, ::LZ4F_getErrorName(rc));
+        sOut.append(buf, iOut);
+        iPos += iIn;
+    }
+    ::LZ4F_freeDecompressionContext(dctx);
+    ASSERT_OR_RAISE(rc == 0, std::runtime_error, "lz4 frame is incomplete.");
+    return sOut;
+}
+#endif
+
+/**
+ * @return true if sData is restored from the file written by cCompressedFile.
+ */
+bool iRoundTrip(
+    const std::string& sName
+    , const sl::cCompressedFile::tCodec& iCodec
+    , std::function<std::string(const std::string&)> oDecompress
+    , const std::string& sData
+    , const int64_t& iFrameBytes
+){
+    const auto sPath = boost::filesystem::temp_directory_path()
+        / boost::filesystem::unique_path("test_compress_%%%%%%%%." + sName);
+    auto iFlushed = false;
+    {
+        sl::cCompressedFile os(sPath.string(), iCodec, 0, iFrameBytes);
+        // Written by uneven pieces, which do not match with the frames.
+        for (size_t iPos = 0; iPos < sData.size(); iPos += 12345)
+        {
+            os.write(sData.data() + iPos, std::min<size_t>(12345, sData.size() - iPos));
+        }
+        // All frames are in the file after flush(), before the destructor.
+        iFlushed = static_cast<bool>(os.flush());
+    }
+    const auto sCompressed = sReadFile(sPath);
+    // Even an empty file must be accepted by the decoder.
+    auto iOk = iFlushed && ! sCompressed.empty();
+    try
+    {
+        iOk = iOk && oDecompress(sCompressed) == sData;
+    }
+    catch (const std::exception& e)
+    {
+        std::cout << e.what() << std::endl;
+        iOk = false;
+    }
+    std::cout << boost::format("%-5s frame=%8d raw=%9d compressed=%9d %s")
+        % sName % iFrameBytes % sData.size() % sCompressed.size() % (iOk ? "OK" : "NG")
+        << std::endl;
+    boost::filesystem::remove(sPath);
+    return iOk;
+}
+
+/**
+ * @return true if flush() reports the failure to write by the badbit.
+ */
+bool iReportsFailure(const std::string& sName, const sl::cCompressedFile::tCodec& iCodec)
+{
+    // Smaller than a frame, so that nothing is written until flush().
+    const auto sData = sMakeSyntheticData(10);
+    sl::cCompressedFile os("/dev/full", iCodec, 0, 1 << 20);
+    os.write(sData.data(), sData.size());
+    const auto iOk = ! os.flush();
+    std::cout << boost::format("%-5s /dev/full %s") % sName % (iOk ? "OK" : "NG") << std::endl;
+    return iOk;
+}
+
+} // ps::lib::test
+} // ps::lib
+} // ps
+
+int main(const int argc, const char* argv[])
+{
+    namespace t = ps::lib::test;
+    namespace sl = ps::lib::nsStreamLocator;
+    try
+    {
+        ps::lib::cTracer::get_mutable_instance().oRedirectTo(
+            boost::filesystem::current_path()
+            / boost::filesystem::path(argv[0]).replace_extension(".log").filename()
+        );
+        sl::vSetCompression(0, 4 << 20, 4);
+        const std::vector<std::tuple<std::string, sl::cCompressedFile::tCodec, std::function<std::string(const std::string&)>>> oCodecs = {
+            std::make_tuple("gzip", sl::cCompressedFile::iGzip, t::sDecompressGzip)
+#ifdef PS_HAVE_ZSTD
+            , std::make_tuple("zstd", sl::cCompressedFile::iZstd, t::sDecompressZstd)
+#endif
+#ifdef PS_HAVE_LZ4
+            , std::make_tuple("lz4", sl::cCompressedFile::iLz4, t::sDecompressLz4)
+#endif
+        };
+        const auto sData = t::sMakeSyntheticData(100000);
+        auto iNumFailures = 0;
+        for (const auto& oCodec: oCodecs)
+        {
+            // Many frames, a frame which ends at the end of the data, and an empty file.
+            iNumFailures += ! t::iRoundTrip(std::get<0>(oCodec), std::get<1>(oCodec), std::get<2>(oCodec), sData, 256 << 10);
+            iNumFailures += ! t::iRoundTrip(std::get<0>(oCodec), std::get<1>(oCodec), std::get<2>(oCodec), sData, sData.size());
+            iNumFailures += ! t::iRoundTrip(std::get<0>(oCodec), std::get<1>(oCodec), std::get<2>(oCodec), std::string(), 256 << 10);
+            iNumFailures += ! t::iReportsFailure(std::get<0>(oCodec), std::get<1>(oCodec));
+        }
+        return iNumFailures ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+}
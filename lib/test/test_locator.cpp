@@ -0,0 +1,82 @@
+#include <pslib.h>
+
+namespace ps
+{
+namespace lib
+{
+namespace test
+{
+
+namespace sl = ps::lib::nsStreamLocator;
+
+/**
+ * @brief
+ *   Opens a data file and a control file of SCOTT.EMP by sLocator,
+ *   and compares their names with the expected ones.
+ */
+bool iExpand(
+    const std::string& sLocator
+    , const std::string& sDelta
+    , const std::string& sData
+    , const std::string& sCtrl
+){
+    const auto sOutput = boost::filesystem::temp_directory_path() / "test_locator";
+    boost::filesystem::create_directories(sOutput);
+    bool iOk = true;
+    std::string sGotData, sGotCtrl;
+    try
+    {
+        sl::vInitialize(sLocator, 0x3, sOutput, {"dat", "ctl", "clo", "blo"}, false);
+        sl::cStreamLocator oLocator("SCOTT", "EMP", "");
+        oLocator.vSetDelta(sDelta);
+        oLocator.oOpen(sl::iExtData, "");
+        sGotData = oLocator.oGetsLastOpendFilename().filename().string();
+        oLocator.oOpen(sl::iExtCtrl, "");
+        sGotCtrl = oLocator.oGetsLastOpendFilename().filename().string();
+        iOk = sGotData == sData && sGotCtrl == sCtrl;
+    }
+    catch (const std::exception& e)
+    {
+        std::cout << e.what() << std::endl;
+        iOk = false;
+    }
+    std::cout << boost::format("%-40s delta=%-10s data=%s ctrl=%s %s")
+        % sLocator % sDelta % sGotData % sGotCtrl % (iOk ? "OK" : "NG")
+        << std::endl;
+    boost::filesystem::remove_all(sOutput);
+    return iOk;
+}
+
+} // ps::lib::test
+} // ps::lib
+} // ps
+
+int main(const int argc, const char* argv[])
+{
+    namespace t = ps::lib::test;
+    try
+    {
+        ps::lib::cTracer::get_mutable_instance().oRedirectTo(
+            boost::filesystem::current_path()
+            / boost::filesystem::path(argv[0]).replace_extension(".log").filename()
+        );
+        const auto sToday = boost::gregorian::to_iso_string(boost::gregorian::day_clock::local_day());
+        auto iNumFailures = 0;
+        // The date macro is not shadowed by the delta.
+        iNumFailures += ! t::iExpand("file://{O}/{C}_{D=yyyyMMdd}.{X}", ""
+            , "EMP_" + sToday + ".dat", "EMP_" + sToday + ".ctl");
+        // The suffix of a delta is put before the extension of the data file only.
+        iNumFailures += ! t::iExpand("file://{O}/{C}_{D=yyyyMMdd}.{X}", "_scn10-20"
+            , "EMP_" + sToday + "_scn10-20.dat", "EMP_" + sToday + ".ctl");
+        iNumFailures += ! t::iExpand("file://{O}/{C}{S}.{X}", "_scn10-20"
+            , "EMP_scn10-20.dat", "EMP.ctl");
+        iNumFailures += ! t::iExpand("file://{O}/{C}{S}.{X}", ""
+            , "EMP.dat", "EMP.ctl");
+        return iNumFailures ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+}
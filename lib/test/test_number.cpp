@@ -0,0 +1,89 @@
+#include <pslib.h>
+
+namespace ps
+{
+namespace lib
+{
+namespace test
+{
+
+namespace occi = ps::lib::sql::occi;
+
+/**
+ * @brief
+ *   Decodes the bytes of an Oracle NUMBER, as DUMP() shows them,
+ *   and compares the text with the one of TO_CHAR(value, sNumFmt).
+ *   An empty sExpected means that the decoder must give it up to OCINumberToText.
+ */
+bool iDecode(
+    const std::vector<ub1>& oBytes
+    , const std::string& sNumFmt
+    , const std::string& sExpected
+){
+    OCINumber val;
+    std::memset(&val, 0, sizeof(val));
+    auto p = reinterpret_cast<ub1*>(&val);
+    p[0] = static_cast<ub1>(oBytes.size());
+    std::copy(oBytes.begin(), oBytes.end(), p + 1);
+    const occi::cNumberDecoder oDecoder(sNumFmt);
+    char szBuffer[128];
+    ub4 iBuffer = sizeof(szBuffer);
+    const auto iDecoded = oDecoder.iIsSupported() && oDecoder.iToText(&val, szBuffer, iBuffer);
+    // The trailing '.' is removed by the caller, as cOtherNumber does.
+    if (iDecoded && iBuffer && szBuffer[iBuffer - 1] == '.')
+    {
+        --iBuffer;
+    }
+    const auto sGot = iDecoded ? std::string(szBuffer, iBuffer) : std::string();
+    const auto iOk = sGot == sExpected;
+    std::vector<std::string> oDump;
+    for (const auto b: oBytes)
+    {
+        oDump.push_back(std::to_string(b));
+    }
+    std::cout << boost::format("%-24s %-20s expected=%-12s got=%-12s %s")
+        % boost::algorithm::join(oDump, ",") % sNumFmt % sExpected % sGot % (iOk ? "OK" : "NG")
+        << std::endl;
+    return iOk;
+}
+
+} // ps::lib::test
+} // ps::lib
+} // ps
+
+int main(const int argc, const char* argv[])
+{
+    namespace t = ps::lib::test;
+    try
+    {
+        ps::lib::cTracer::get_mutable_instance().oRedirectTo(
+            boost::filesystem::current_path()
+            / boost::filesystem::path(argv[0]).replace_extension(".log").filename()
+        );
+        auto iNumFailures = 0;
+        // Zero, integers, fractions, negatives with the terminator 102, and rounding half away from zero.
+        iNumFailures += ! t::iDecode({128}, "fm999.99", "0");
+        iNumFailures += ! t::iDecode({193, 100}, "fm999", "99");
+        iNumFailures += ! t::iDecode({194, 2}, "fm999", "100");
+        iNumFailures += ! t::iDecode({62, 100, 102}, "fm999", "-1");
+        iNumFailures += ! t::iDecode({194, 2, 24, 46}, "fm99999.99", "123.45");
+        iNumFailures += ! t::iDecode({61, 100, 78, 56, 102}, "fm99999.99", "-123.45");
+        iNumFailures += ! t::iDecode({192, 51}, "fm999.99", ".5");
+        iNumFailures += ! t::iDecode({192, 51}, "fm990.99", "0.5");
+        iNumFailures += ! t::iDecode({192, 2}, "fm0.99", "0.01");
+        iNumFailures += ! t::iDecode({196, 2, 24, 46, 68, 90}, "fm9999999.9", "1234567.9");
+        iNumFailures += ! t::iDecode({193, 13, 51}, "fm99", "13");
+        iNumFailures += ! t::iDecode({62, 89, 51, 102}, "fm99", "-13");
+        iNumFailures += ! t::iDecode({194, 2, 24, 46}, "fm9.99EEEE", "1.23E+02");
+        // TO_CHAR fills it with '#', which is left to OCINumberToText.
+        iNumFailures += ! t::iDecode({196, 2, 24, 46, 68, 90}, "fm999", "");
+        // G and D depend on NLS_NUMERIC_CHARACTERS of the session, which is left to OCINumberToText.
+        iNumFailures += ! t::iDecode({194, 2, 24, 46}, "fm999G999D99", "");
+        return iNumFailures ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+}